@@ -0,0 +1,418 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <optional>
+#include <utility>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../Concurrency/ThreadPool.hpp"
+
+// Tells the compiler the iterations of the following loop are independent, so it can vectorize it freely
+#if defined(__clang__)
+	#define NSTD_UNSEQ_LOOP _Pragma("clang loop vectorize(enable) interleave(enable)")
+#elif defined(__GNUC__)
+	#define NSTD_UNSEQ_LOOP _Pragma("GCC ivdep")
+#elif defined(_MSC_VER)
+	#define NSTD_UNSEQ_LOOP __pragma(loop(ivdep))
+#else
+	#define NSTD_UNSEQ_LOOP
+#endif
+
+namespace nstd {
+	namespace execution {
+		// Runs on the calling thread, in order
+		class SequencedPolicy { };
+
+		// Runs on the calling thread, iterations may be vectorized and reordered
+		class UnsequencedPolicy { };
+
+		// Runs on the thread pool, each chunk in order
+		class ParallelPolicy { };
+
+		// Runs on the thread pool, each chunk vectorized
+		class ParallelUnsequencedPolicy { };
+
+		inline constexpr SequencedPolicy		   seq{};
+		inline constexpr UnsequencedPolicy		   unseq{};
+		inline constexpr ParallelPolicy			   par{};
+		inline constexpr ParallelUnsequencedPolicy par_unseq{};
+	}
+
+	template<typename T> struct is_execution_policy : std::false_type { };
+	template<> struct is_execution_policy<execution::SequencedPolicy>			: std::true_type { };
+	template<> struct is_execution_policy<execution::UnsequencedPolicy>			: std::true_type { };
+	template<> struct is_execution_policy<execution::ParallelPolicy>			: std::true_type { };
+	template<> struct is_execution_policy<execution::ParallelUnsequencedPolicy> : std::true_type { };
+
+	template<typename T>
+	inline constexpr bool is_execution_policy_v = is_execution_policy<std::decay_t<T>>::value;
+
+	namespace detail {
+		// Number of independent accumulators used by the unsequenced reductions
+		constexpr size_t UNSEQ_LANES = 8;
+
+		template<typename Policy>
+		constexpr bool IsParallel = std::is_same_v<std::decay_t<Policy>, execution::ParallelPolicy>
+								 || std::is_same_v<std::decay_t<Policy>, execution::ParallelUnsequencedPolicy>;
+
+		template<typename Policy>
+		constexpr bool IsUnsequenced = std::is_same_v<std::decay_t<Policy>, execution::UnsequencedPolicy>
+									|| std::is_same_v<std::decay_t<Policy>, execution::ParallelUnsequencedPolicy>;
+
+		// Anything exposing its elements as a contiguous data() / size() pair: Vector, Array, Span...
+		template<typename Range>
+		using RangeValue = std::remove_pointer_t<decltype(std::declval<Range&>().data())>;
+
+		template<typename Range, typename = void>
+		struct IsContiguousRange : std::false_type { };
+
+		template<typename Range>
+		struct IsContiguousRange<Range, std::void_t<decltype(std::declval<Range&>().data()), decltype(std::declval<Range&>().size())>>
+			: std::is_pointer<decltype(std::declval<Range&>().data())> { };
+
+		template<typename Policy, typename Range, typename Result = void>
+		using EnableForRange = std::enable_if_t<is_execution_policy_v<Policy> && IsContiguousRange<Range>::value, Result>;
+
+		// Splits uCount elements into blocks worth shipping to the pool, 1 means the range should stay on the calling thread
+		inline size_t BlockCount(size_t uCount, const ThreadPool& pool) {
+			size_t uBlocks	  = (uCount + PARALLEL_MIN_GRAIN - 1) / PARALLEL_MIN_GRAIN;
+			size_t uMaxBlocks = (pool.thread_count() + 1) * 4;
+
+			return uBlocks < uMaxBlocks ? uBlocks : uMaxBlocks;
+		}
+
+		// Calls func(uBlock, uFirst, uLast) for each of uBlocks evenly sized blocks of [0; uCount) on the pool
+		template<typename Func>
+		void ForEachBlock(ThreadPool& pool, size_t uCount, size_t uBlocks, const Func& func) {
+			parallel_for(0, uBlocks, [&](size_t uFirstBlock, size_t uLastBlock) {
+				for (size_t b = uFirstBlock; b < uLastBlock; ++b)
+					func(b, uCount * b / uBlocks, uCount * (b + 1) / uBlocks);
+			}, 1, pool);
+		}
+
+		template<bool bUnseq, typename T, typename Func>
+		void ForEach(T* pData, size_t uCount, Func& func) {
+			if constexpr (bUnseq) {
+				NSTD_UNSEQ_LOOP
+				for (size_t i = 0; i < uCount; ++i)
+					func(pData[i]);
+			}
+			else {
+				for (size_t i = 0; i < uCount; ++i)
+					func(pData[i]);
+			}
+		}
+
+		template<bool bUnseq, typename In, typename Out, typename Func>
+		void Transform(In* pIn, Out* pOut, size_t uCount, Func& func) {
+			if constexpr (bUnseq) {
+				NSTD_UNSEQ_LOOP
+				for (size_t i = 0; i < uCount; ++i)
+					pOut[i] = func(pIn[i]);
+			}
+			else {
+				for (size_t i = 0; i < uCount; ++i)
+					pOut[i] = func(pIn[i]);
+			}
+		}
+
+		template<typename T, typename In, typename Func, size_t... I>
+		std::array<T, sizeof...(I)> LoadLanes(In* pData, Func& transform, std::index_sequence<I...>) {
+			return { { T(transform(pData[I]))... } };
+		}
+
+		// Reduces a non-empty range without an initial value. The unsequenced version keeps UNSEQ_LANES
+		// independent accumulators, which breaks the dependency chain and lets the loop vectorize
+		template<bool bUnseq, typename T, typename In, typename Reduce, typename Func>
+		T TransformReduce(In* pData, size_t uCount, Reduce& reduce, Func& transform) {
+			if constexpr (bUnseq) {
+				if (uCount >= UNSEQ_LANES * 2) {
+					std::array<T, UNSEQ_LANES> lanes = LoadLanes<T>(pData, transform, std::make_index_sequence<UNSEQ_LANES>());
+					size_t uVectorEnd = uCount - uCount % UNSEQ_LANES;
+
+					for (size_t i = UNSEQ_LANES; i < uVectorEnd; i += UNSEQ_LANES) {
+						NSTD_UNSEQ_LOOP
+						for (size_t k = 0; k < UNSEQ_LANES; ++k)
+							lanes[k] = reduce(std::move(lanes[k]), transform(pData[i + k]));
+					}
+
+					for (size_t i = uVectorEnd; i < uCount; ++i)
+						lanes[0] = reduce(std::move(lanes[0]), transform(pData[i]));
+
+					for (size_t k = 1; k < UNSEQ_LANES; ++k)
+						lanes[0] = reduce(std::move(lanes[0]), std::move(lanes[k]));
+
+					return std::move(lanes[0]);
+				}
+			}
+
+			T acc = transform(pData[0]);
+
+			for (size_t i = 1; i < uCount; ++i)
+				acc = reduce(std::move(acc), transform(pData[i]));
+
+			return acc;
+		}
+
+		template<bool bUnseq, typename In, typename Pred>
+		size_t CountIf(In* pData, size_t uCount, Pred& pred) {
+			size_t uResult = 0;
+
+			if constexpr (bUnseq) {
+				NSTD_UNSEQ_LOOP
+				for (size_t i = 0; i < uCount; ++i)
+					uResult += pred(pData[i]) ? 1 : 0;
+			}
+			else {
+				for (size_t i = 0; i < uCount; ++i)
+					uResult += pred(pData[i]) ? 1 : 0;
+			}
+
+			return uResult;
+		}
+
+		template<typename In, typename Pred>
+		size_t FindIf(In* pData, size_t uFirst, size_t uLast, Pred& pred) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				if (pred(pData[i]))
+					return i;
+
+			return (size_t)-1;
+		}
+
+		// Scans [0; uCount) into pOut. If pOffset is given it's folded in front of the block:
+		// for an exclusive scan it becomes the first output, for an inclusive one it's combined with the first element
+		template<bool bExclusive, typename T, typename In, typename Out, typename Op>
+		void Scan(In* pIn, Out* pOut, size_t uCount, const T* pOffset, Op& op) {
+			if (uCount == 0)
+				return;
+
+			if constexpr (bExclusive) {
+				T acc = *pOffset;
+
+				for (size_t i = 0; i < uCount; ++i) {
+					T next = op(acc, pIn[i]);
+
+					pOut[i] = std::move(acc);
+					acc = std::move(next);
+				}
+			}
+			else {
+				T acc = pOffset ? op(*pOffset, pIn[0]) : T(pIn[0]);
+
+				pOut[0] = acc;
+
+				for (size_t i = 1; i < uCount; ++i) {
+					acc = op(std::move(acc), pIn[i]);
+					pOut[i] = acc;
+				}
+			}
+		}
+
+		// Two-pass blocked scan: every block is reduced in parallel, the block sums are scanned serially
+		// into per-block offsets, then every block is scanned in parallel starting from its offset.
+		// Safe to run in place, since each element is read before it's written in the second pass.
+		// Scans only ask for an associative op, so every block is reduced strictly in order, never in unsequenced lanes
+		template<bool bExclusive, typename T, typename In, typename Out, typename Op>
+		void BlockedScan(In* pIn, Out* pOut, size_t uCount, const T* pInit, Op& op) {
+			ThreadPool& pool = ThreadPool::instance();
+			size_t uBlocks = BlockCount(uCount, pool);
+
+			if (uBlocks <= 1) {
+				Scan<bExclusive>(pIn, pOut, uCount, pInit, op);
+
+				return;
+			}
+
+			auto identity = [](const auto& value) -> const auto& { return value; };
+			std::vector<std::optional<T>> sums(uBlocks);
+
+			ForEachBlock(pool, uCount, uBlocks, [&](size_t uBlock, size_t uFirst, size_t uLast) {
+				sums[uBlock].emplace(TransformReduce<false, T>(pIn + uFirst, uLast - uFirst, op, identity));
+			});
+
+			std::vector<std::optional<T>> offsets(uBlocks);
+
+			if (pInit)
+				offsets[0].emplace(*pInit);
+
+			for (size_t b = 1; b < uBlocks; ++b)
+				offsets[b].emplace(offsets[b - 1] ? op(*offsets[b - 1], std::move(*sums[b - 1])) : std::move(*sums[b - 1]));
+
+			ForEachBlock(pool, uCount, uBlocks, [&](size_t uBlock, size_t uFirst, size_t uLast) {
+				Scan<bExclusive>(pIn + uFirst, pOut + uFirst, uLast - uFirst, offsets[uBlock] ? &*offsets[uBlock] : (const T*)nullptr, op);
+			});
+		}
+
+		template<typename InRange, typename OutRange>
+		void CheckOutputSize(const InRange& in, const OutRange& out) {
+			if (out.size() < in.size())
+				throw std::out_of_range("The output range is smaller than the input range");
+		}
+	}
+
+	// Calls func on every element of the range
+	template<typename Policy, typename Range, typename Func>
+	auto for_each(Policy&&, Range&& range, Func func) -> detail::EnableForRange<Policy, Range> {
+		constexpr bool bUnseq = detail::IsUnsequenced<Policy>;
+		auto*		   pData  = range.data();
+		size_t		   uCount = range.size();
+
+		if constexpr (detail::IsParallel<Policy>) {
+			parallel_for(0, uCount, [pData, &func](size_t uFirst, size_t uLast) {
+				detail::ForEach<bUnseq>(pData + uFirst, uLast - uFirst, func);
+			});
+		}
+		else {
+			detail::ForEach<bUnseq>(pData, uCount, func);
+		}
+	}
+
+	// Writes func(in[i]) into out[i]. Throws if out is smaller than in, in and out may be the same range
+	template<typename Policy, typename InRange, typename OutRange, typename Func>
+	auto transform(Policy&&, InRange&& in, OutRange&& out, Func func) -> detail::EnableForRange<Policy, OutRange> {
+		constexpr bool bUnseq = detail::IsUnsequenced<Policy>;
+		auto*		   pIn	  = in.data();
+		auto*		   pOut	  = out.data();
+
+		detail::CheckOutputSize(in, out);
+
+		if constexpr (detail::IsParallel<Policy>) {
+			parallel_for(0, in.size(), [pIn, pOut, &func](size_t uFirst, size_t uLast) {
+				detail::Transform<bUnseq>(pIn + uFirst, pOut + uFirst, uLast - uFirst, func);
+			});
+		}
+		else {
+			detail::Transform<bUnseq>(pIn, pOut, in.size(), func);
+		}
+	}
+
+	// Folds transform(element) of every element into init with reduce. Elements may be combined
+	// in any order, so reduce has to be associative and commutative
+	template<typename Policy, typename Range, typename T, typename Reduce, typename Func>
+	auto transform_reduce(Policy&&, Range&& range, T init, Reduce op, Func func) -> detail::EnableForRange<Policy, Range, T> {
+		constexpr bool bUnseq = detail::IsUnsequenced<Policy>;
+		auto*		   pData  = range.data();
+		size_t		   uCount = range.size();
+
+		if (uCount == 0)
+			return init;
+
+		if constexpr (detail::IsParallel<Policy>) {
+			ThreadPool& pool = ThreadPool::instance();
+			size_t uBlocks = detail::BlockCount(uCount, pool);
+
+			if (uBlocks > 1) {
+				std::vector<std::optional<T>> partials(uBlocks);
+
+				detail::ForEachBlock(pool, uCount, uBlocks, [&](size_t uBlock, size_t uFirst, size_t uLast) {
+					partials[uBlock].emplace(detail::TransformReduce<bUnseq, T>(pData + uFirst, uLast - uFirst, op, func));
+				});
+
+				for (std::optional<T>& partial : partials)
+					init = op(std::move(init), std::move(*partial));
+
+				return init;
+			}
+		}
+
+		return op(std::move(init), detail::TransformReduce<bUnseq, T>(pData, uCount, op, func));
+	}
+
+	// Folds every element into init with reduce, see transform_reduce
+	template<typename Policy, typename Range, typename T, typename Reduce = std::plus<>>
+	auto reduce(Policy&& policy, Range&& range, T init, Reduce op = Reduce{}) -> detail::EnableForRange<Policy, Range, T> {
+		return transform_reduce(std::forward<Policy>(policy), std::forward<Range>(range), std::move(init), op,
+								[](const auto& value) -> const auto& { return value; });
+	}
+
+	// Counts the elements satisfying pred
+	template<typename Policy, typename Range, typename Pred>
+	auto count_if(Policy&&, Range&& range, Pred pred) -> detail::EnableForRange<Policy, Range, size_t> {
+		constexpr bool bUnseq = detail::IsUnsequenced<Policy>;
+		auto*		   pData  = range.data();
+		size_t		   uCount = range.size();
+
+		if constexpr (detail::IsParallel<Policy>) {
+			return parallel_reduce(0, uCount, (size_t)0, [pData, &pred](size_t uFirst, size_t uLast, size_t uAcc) {
+				return uAcc + detail::CountIf<bUnseq>(pData + uFirst, uLast - uFirst, pred);
+			}, std::plus<size_t>());
+		}
+		else {
+			return detail::CountIf<bUnseq>(pData, uCount, pred);
+		}
+	}
+
+	// Returns the index of the first element satisfying pred. Returns -1 if none found.
+	// The parallel version stops scanning chunks that lie past an already found match
+	template<typename Policy, typename Range, typename Pred>
+	auto find_if(Policy&&, Range&& range, Pred pred) -> detail::EnableForRange<Policy, Range, size_t> {
+		auto*  pData  = range.data();
+		size_t uCount = range.size();
+
+		if constexpr (detail::IsParallel<Policy>) {
+			std::atomic<size_t> uFound = (size_t)-1;
+
+			parallel_for(0, uCount, [pData, &pred, &uFound](size_t uFirst, size_t uLast) {
+				constexpr size_t STEP = 256;
+
+				for (size_t i = uFirst; i < uLast && i < uFound.load(std::memory_order_relaxed); i += STEP) {
+					size_t uIndex = detail::FindIf(pData, i, i + STEP < uLast ? i + STEP : uLast, pred);
+
+					if (uIndex == (size_t)-1)
+						continue;
+
+					size_t uCurrent = uFound.load(std::memory_order_relaxed);
+
+					while (uIndex < uCurrent && !uFound.compare_exchange_weak(uCurrent, uIndex, std::memory_order_relaxed));
+
+					return;
+				}
+			});
+
+			return uFound.load();
+		}
+		else {
+			return detail::FindIf(pData, 0, uCount, pred);
+		}
+	}
+
+	// out[i] = in[0] op in[1] op ... op in[i]. Throws if out is smaller than in, in and out may be the same range
+	template<typename Policy, typename InRange, typename OutRange, typename Op = std::plus<>>
+	auto inclusive_scan(Policy&&, InRange&& in, OutRange&& out, Op op = Op{}) -> detail::EnableForRange<Policy, OutRange> {
+		using T = std::remove_cv_t<detail::RangeValue<InRange>>;
+
+		detail::CheckOutputSize(in, out);
+
+		if constexpr (detail::IsParallel<Policy>)
+			detail::BlockedScan<false, T>(in.data(), out.data(), in.size(), (const T*)nullptr, op);
+		else
+			detail::Scan<false, T>(in.data(), out.data(), in.size(), (const T*)nullptr, op);
+	}
+
+	// out[i] = init op in[0] op ... op in[i]. Throws if out is smaller than in, in and out may be the same range
+	template<typename Policy, typename InRange, typename OutRange, typename Op, typename T>
+	auto inclusive_scan(Policy&&, InRange&& in, OutRange&& out, Op op, T init) -> detail::EnableForRange<Policy, OutRange> {
+		detail::CheckOutputSize(in, out);
+
+		if constexpr (detail::IsParallel<Policy>)
+			detail::BlockedScan<false, T>(in.data(), out.data(), in.size(), &init, op);
+		else
+			detail::Scan<false, T>(in.data(), out.data(), in.size(), &init, op);
+	}
+
+	// out[i] = init op in[0] op ... op in[i - 1]. Throws if out is smaller than in, in and out may be the same range
+	template<typename Policy, typename InRange, typename OutRange, typename T, typename Op = std::plus<>>
+	auto exclusive_scan(Policy&&, InRange&& in, OutRange&& out, T init, Op op = Op{}) -> detail::EnableForRange<Policy, OutRange> {
+		detail::CheckOutputSize(in, out);
+
+		if constexpr (detail::IsParallel<Policy>)
+			detail::BlockedScan<true, T>(in.data(), out.data(), in.size(), &init, op);
+		else
+			detail::Scan<true, T>(in.data(), out.data(), in.size(), &init, op);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include "../Memory/Memory.hpp"
+#include "../Ranges/Views.hpp"
+#include "../Containers/Vector.hpp"
+
+namespace nstd {
+	// Distance to pass to for_each_indirect when in doubt, enough to cover a cache miss with a little work per element
+	constexpr size_t PREFETCH_DISTANCE = 8;
+
+	namespace detail {
+		template<typename Range, typename = void>
+		struct HasSize : std::false_type { };
+
+		template<typename Range>
+		struct HasSize<Range, std::void_t<decltype(std::declval<Range&>().size())>> : std::true_type { };
+	}
+
+	// Collects pointers to the elements of range in order. The walk over the links is paid once, after which the
+	// elements can be visited through for_each_indirect as often as needed while the range isn't modified
+	template<typename Range>
+	auto linearize(Range& range) {
+		Vector<std::remove_reference_t<RangeReference<Range>>*> pointers;
+
+		if constexpr (detail::HasSize<Range>::value)
+			pointers.reserve(range.size());
+
+		for (auto& element : range)
+			pointers.push_back(nstd::addressof(element));
+
+		return pointers;
+	}
+
+	// Calls fn(*pointers[i]) in order, prefetching the element uDistance positions ahead. Unlike following links,
+	// the addresses are known up front, so the misses of the next uDistance elements are all in flight at once
+	template<typename T, typename Func>
+	void for_each_indirect(const Vector<T*>& pointers, size_t uDistance, Func fn) {
+		size_t uSize = pointers.size();
+
+		for (size_t i = 0; i < uSize; ++i) {
+			if (i + uDistance < uSize)
+				prefetch(pointers[i + uDistance]);
+
+			fn(*pointers[i]);
+		}
+	}
+
+	// Linearizes range and visits it through for_each_indirect. Costs a walk and a pointer vector on top of the
+	// visit itself, so it pays off when fn touches more than the element or before a second pass
+	template<typename Range, typename Func>
+	void for_each_linearized(Range& range, size_t uDistance, Func fn) {
+		for_each_indirect(linearize(range), uDistance, std::move(fn));
+	}
+}
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+
+namespace nstd {
+	// Tag telling a sorted container that its input is already sorted and free of duplicate keys
+	struct SortedUniqueTag { };
+
+	inline constexpr SortedUniqueTag sorted_unique{};
+
+	// Returns the index of the first of the uSize sorted elements at pData that isn't ordered before key, or uSize if there is none.
+	// Unlike a textbook binary search there is no early exit and no data dependent branch: the loop always runs log2(uSize)
+	// times and the comparison only selects the next base, which compiles to a conditional move, so mispredictions
+	// never stall the search and the loads of consecutive lookups can overlap
+	template<typename T, typename Key, typename Compare = std::less<>>
+	size_t branchless_lower_bound(const T* pData, size_t uSize, const Key& key, Compare comp = Compare{}) {
+		if (uSize == 0)
+			return 0;
+
+		const T* pBase = pData;
+
+		while (uSize > 1) {
+			size_t uHalf = uSize / 2;
+
+			pBase += comp(pBase[uHalf - 1], key) ? uHalf : 0;
+			uSize -= uHalf;
+		}
+
+		return (size_t)(pBase - pData) + (comp(*pBase, key) ? 1 : 0);
+	}
+
+	// Returns the index of the first of the uSize sorted elements at pData that is ordered after key, or uSize if there is none.
+	// Look for: branchless_lower_bound
+	template<typename T, typename Key, typename Compare = std::less<>>
+	size_t branchless_upper_bound(const T* pData, size_t uSize, const Key& key, Compare comp = Compare{}) {
+		if (uSize == 0)
+			return 0;
+
+		const T* pBase = pData;
+
+		while (uSize > 1) {
+			size_t uHalf = uSize / 2;
+
+			pBase += comp(key, pBase[uHalf - 1]) ? 0 : uHalf;
+			uSize -= uHalf;
+		}
+
+		return (size_t)(pBase - pData) + (comp(key, *pBase) ? 0 : 1);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <bit>
+#include <algorithm>
+#include <mutex>
+#include <memory>
+#include <thread>
+#include <optional>
+#include <shared_mutex>
+
+#include "../Memory/Memory.hpp"
+#include "../Containers/HashMap.hpp"
+
+namespace nstd {
+	// Hash map safe to use from any number of threads. Keys are spread over independent shards, each a HashMap
+	// guarded by its own reader-writer lock and padded to a cache line, so threads touching different shards never
+	// contend and readers of the same shard don't block each other.
+	// Values are handed out as copies or through callbacks run under the shard's lock, never as references
+	template<typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>, typename Alloc = Allocator<std::pair<const K, V>>>
+	class ConcurrentHashMap {
+		public:
+			using KeyType	 = K;
+			using MappedType = V;
+			using ValueType	 = std::pair<const K, V>;
+			using ShardType	 = HashMap<K, V, Hash, Eq, Alloc>;
+
+		public:
+			// uShardCount is rounded up to a power of two, defaults to a few shards per hardware thread
+			explicit ConcurrentHashMap(size_t uShardCount = DefaultShardCount()) {
+				m_uShardCount = std::bit_ceil(uShardCount ? uShardCount : 1);
+				m_uShardShift = 64 - std::countr_zero(m_uShardCount);
+				m_pShards	  = std::make_unique<Shard[]>(m_uShardCount);
+			}
+
+			ConcurrentHashMap(const ConcurrentHashMap&) = delete;
+			ConcurrentHashMap& operator =(const ConcurrentHashMap&) = delete;
+
+			// Returns a copy of the value mapped to key, or nothing if there is none
+			std::optional<V> find(const K& key) const {
+				const Shard& shard = ShardOf(key);
+				std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+
+				auto itr = shard.Map.find(key);
+
+				if (itr == shard.Map.end())
+					return std::nullopt;
+
+				return itr->second;
+			}
+
+			// Calls func(const V&) under the shard's read lock if key is present, avoids copying large values.
+			// Returns true if key was found
+			template<typename Func>
+			bool visit(const K& key, Func&& func) const {
+				const Shard& shard = ShardOf(key);
+				std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+
+				auto itr = shard.Map.find(key);
+
+				if (itr == shard.Map.end())
+					return false;
+
+				func(static_cast<const V&>(itr->second));
+
+				return true;
+			}
+
+			// Returns true if an element with the given key exists, false otherwise
+			bool contains(const K& key) const {
+				const Shard& shard = ShardOf(key);
+				std::shared_lock<std::shared_mutex> lock(shard.Mutex);
+
+				return shard.Map.contains(key);
+			}
+
+			// Inserts value under key if key isn't present yet. Returns true if the insertion took place
+			template<typename Value>
+			bool insert(const K& key, Value&& value) {
+				Shard& shard = ShardOf(key);
+				std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+
+				return shard.Map.try_emplace(key, std::forward<Value>(value)).second;
+			}
+
+			// Assigns value to key, inserting it if there is none. Returns true if it was inserted
+			template<typename Value>
+			bool insert_or_assign(const K& key, Value&& value) {
+				Shard& shard = ShardOf(key);
+				std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+
+				return shard.Map.insert_or_assign(key, std::forward<Value>(value)).second;
+			}
+
+			// Calls func(V&) on the value mapped to key under the shard's write lock, default constructing
+			// the value first if there is none. Returns true if the value was inserted
+			template<typename Func>
+			bool upsert(const K& key, Func&& func) {
+				Shard& shard = ShardOf(key);
+				std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+
+				auto result = shard.Map.try_emplace(key);
+
+				func(result.first->second);
+
+				return result.second;
+			}
+
+			// Erases the element with the given key. Returns true if there was one
+			bool erase(const K& key) {
+				Shard& shard = ShardOf(key);
+				std::unique_lock<std::shared_mutex> lock(shard.Mutex);
+
+				return shard.Map.erase(key) != 0;
+			}
+
+			// Calls func(const ShardType&) on every shard in turn, each under its read lock
+			template<typename Func>
+			void for_each_shard(Func&& func) const {
+				for (size_t i = 0; i < m_uShardCount; ++i) {
+					std::shared_lock<std::shared_mutex> lock(m_pShards[i].Mutex);
+
+					func(static_cast<const ShardType&>(m_pShards[i].Map));
+				}
+			}
+
+			// Calls func(ShardType&) on every shard in turn, each under its write lock
+			template<typename Func>
+			void for_each_shard(Func&& func) {
+				for (size_t i = 0; i < m_uShardCount; ++i) {
+					std::unique_lock<std::shared_mutex> lock(m_pShards[i].Mutex);
+
+					func(m_pShards[i].Map);
+				}
+			}
+
+			// Calls func(const K&, const V&) on every element, one shard at a time under its read lock
+			template<typename Func>
+			void for_each(Func&& func) const {
+				for_each_shard([&func](const ShardType& shard) {
+					for (const ValueType& value : shard)
+						func(value.first, value.second);
+				});
+			}
+
+			// Erases every element
+			void clear() {
+				for_each_shard([](ShardType& shard) { shard.clear(); });
+			}
+
+			// Makes room for about uCount elements spread evenly over the shards
+			void reserve(size_t uCount) {
+				size_t uPerShard = uCount / m_uShardCount + 1;
+
+				for_each_shard([uPerShard](ShardType& shard) { shard.reserve(uPerShard); });
+			}
+
+			// Sum of the shard sizes, only exact while no other thread is modifying the map
+			size_t size() const {
+				size_t uSize = 0;
+
+				for_each_shard([&uSize](const ShardType& shard) { uSize += shard.size(); });
+
+				return uSize;
+			}
+
+			bool empty() const {
+				return size() == 0;
+			}
+
+			size_t shard_count() const {
+				return m_uShardCount;
+			}
+
+		private:
+			struct alignas(CACHE_LINE_SIZE) Shard {
+				mutable std::shared_mutex Mutex;
+				ShardType				  Map;
+			};
+
+			static size_t DefaultShardCount() {
+				return std::max(1u, std::thread::hardware_concurrency()) * 4;
+			}
+
+			// Shards are picked by the top bits of the mixed hash, the shard's table indexes by the low ones
+			size_t ShardIndex(const K& key) const {
+				if (m_uShardCount == 1)
+					return 0;
+
+				return (size_t)(detail::MixHash((uint64_t)m_Hash(key)) >> m_uShardShift);
+			}
+
+			Shard& ShardOf(const K& key) {
+				return m_pShards[ShardIndex(key)];
+			}
+
+			const Shard& ShardOf(const K& key) const {
+				return m_pShards[ShardIndex(key)];
+			}
+
+		private:
+			std::unique_ptr<Shard[]> m_pShards;
+			size_t					 m_uShardCount;
+			size_t					 m_uShardShift;
+			Hash					 m_Hash;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <optional>
+
+#include "EpochDomain.hpp"
+#include "../Memory/Memory.hpp"
+
+namespace nstd {
+	// Lock-free LIFO stack for any number of threads (Treiber stack). Push and pop swing the top pointer with a
+	// single CAS. Popped nodes are retired through an EpochDomain instead of being freed on the spot, so a
+	// concurrent pop never reads a freed node and a recycled node can't fool its CAS (no ABA).
+	// Nodes are allocated through Alloc, which has to be stateless since retired nodes outlive the pop that
+	// unlinked them
+	template<typename T, typename Alloc = Allocator<T>>
+	class ConcurrentStack {
+		private:
+			struct Node {
+				T	  Value;
+				Node* pNext;
+			};
+
+			using NodeAllocator = typename Alloc::template rebind<Node>::other;
+
+		public:
+			using ValueType = T;
+
+		public:
+			// Uses a domain of its own
+			ConcurrentStack()
+				: m_Domain(m_OwnDomain) { }
+
+			// Shares domain with other structures, which has to outlive the stack
+			explicit ConcurrentStack(EpochDomain& domain)
+				: m_Domain(domain) { }
+
+			ConcurrentStack(const ConcurrentStack&) = delete;
+			ConcurrentStack& operator =(const ConcurrentStack&) = delete;
+
+			// Must not race with any other call
+			~ConcurrentStack() {
+				Node* pNode = m_pTop.load(std::memory_order_relaxed);
+
+				while (pNode) {
+					Node* pNext = pNode->pNext;
+
+					m_Allocator.destroy(pNode);
+					m_Allocator.deallocate(pNode, 1);
+
+					pNode = pNext;
+				}
+			}
+
+			void push(const T& value) {
+				emplace(value);
+			}
+
+			void push(T&& value) {
+				emplace(std::move(value));
+			}
+
+			// Constructs T(args...) in a new node and puts it on top
+			template<typename... Args>
+			void emplace(Args&&... args) {
+				Node* pNode = m_Allocator.allocate(1);
+
+				try {
+					new(&pNode->Value) T(std::forward<Args>(args)...);
+				}
+				catch (...) {
+					m_Allocator.deallocate(pNode, 1);
+
+					throw;
+				}
+
+				pNode->pNext = m_pTop.load(std::memory_order_relaxed);
+
+				while (!m_pTop.compare_exchange_weak(pNode->pNext, pNode, std::memory_order_release, std::memory_order_relaxed));
+			}
+
+			// Removes the top value, or returns nothing if the stack is empty
+			std::optional<T> pop() {
+				EpochGuard guard = m_Domain.pin();
+				Node*	   pNode = m_pTop.load(std::memory_order_acquire);
+
+				while (pNode && !m_pTop.compare_exchange_weak(pNode, pNode->pNext, std::memory_order_acquire, std::memory_order_acquire));
+
+				if (!pNode)
+					return std::nullopt;
+
+				std::optional<T> value(std::move(pNode->Value));
+
+				guard.template retire<NodeAllocator>(pNode);
+
+				return value;
+			}
+
+			// Moves the top value into value. Returns false if the stack is empty
+			bool try_pop(T& value) {
+				std::optional<T> top = pop();
+
+				if (!top)
+					return false;
+
+				value = std::move(*top);
+
+				return true;
+			}
+
+			// Approximate when called concurrently with push/pop
+			bool empty() const {
+				return m_pTop.load(std::memory_order_relaxed) == nullptr;
+			}
+
+		private:
+			alignas(CACHE_LINE_SIZE) std::atomic<Node*> m_pTop = nullptr;
+
+			NodeAllocator m_Allocator;
+			EpochDomain	  m_OwnDomain;
+			EpochDomain&  m_Domain;
+	};
+}
\ No newline at end of file
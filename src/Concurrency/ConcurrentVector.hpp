@@ -0,0 +1,420 @@
+#pragma once
+
+#include <bit>
+#include <new>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../Memory/Memory.hpp"
+#include "../Containers/Vector.hpp"
+
+namespace nstd {
+	template<typename Vec, bool bConst>
+	class ConcurrentVectorIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename Vec::ValueType, typename Vec::ValueType>;
+
+			using iterator_concept	= std::random_access_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename Vec::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		private:
+			using VectorPtr = std::conditional_t<bConst, const Vec*, Vec*>;
+
+		public:
+			ConcurrentVectorIterator() = default;
+
+			ConcurrentVectorIterator(VectorPtr pVector, size_t uIndex)
+				: m_pVector(pVector), m_uIndex(uIndex) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			ConcurrentVectorIterator(const ConcurrentVectorIterator<Vec, bOtherConst>& other)
+				: m_pVector(other.m_pVector), m_uIndex(other.m_uIndex) { }
+
+			ConcurrentVectorIterator& operator ++() {
+				++m_uIndex;
+
+				return *this;
+			}
+
+			ConcurrentVectorIterator operator ++(int) {
+				ConcurrentVectorIterator itr = *this;
+
+				++m_uIndex;
+
+				return itr;
+			}
+
+			ConcurrentVectorIterator& operator --() {
+				--m_uIndex;
+
+				return *this;
+			}
+
+			ConcurrentVectorIterator operator --(int) {
+				ConcurrentVectorIterator itr = *this;
+
+				--m_uIndex;
+
+				return itr;
+			}
+
+			ValueType& operator [](difference_type iIndex) const {
+				return (*m_pVector)[m_uIndex + iIndex];
+			}
+
+			ValueType* operator ->() const {
+				return &(*m_pVector)[m_uIndex];
+			}
+
+			ValueType& operator *() const {
+				return (*m_pVector)[m_uIndex];
+			}
+
+			difference_type operator -(const ConcurrentVectorIterator& other) const {
+				return (difference_type)(m_uIndex - other.m_uIndex);
+			}
+
+			ConcurrentVectorIterator operator +(difference_type iOffset) const {
+				return ConcurrentVectorIterator(m_pVector, m_uIndex + iOffset);
+			}
+
+			ConcurrentVectorIterator operator -(difference_type iOffset) const {
+				return ConcurrentVectorIterator(m_pVector, m_uIndex - iOffset);
+			}
+
+			ConcurrentVectorIterator& operator +=(difference_type iOffset) {
+				m_uIndex += iOffset;
+
+				return *this;
+			}
+
+			ConcurrentVectorIterator& operator -=(difference_type iOffset) {
+				m_uIndex -= iOffset;
+
+				return *this;
+			}
+
+			bool operator ==(const ConcurrentVectorIterator& other) const {
+				return m_uIndex == other.m_uIndex;
+			}
+
+			bool operator !=(const ConcurrentVectorIterator& other) const {
+				return m_uIndex != other.m_uIndex;
+			}
+
+			bool operator <(const ConcurrentVectorIterator& other) const {
+				return m_uIndex < other.m_uIndex;
+			}
+
+			bool operator <=(const ConcurrentVectorIterator& other) const {
+				return m_uIndex <= other.m_uIndex;
+			}
+
+			bool operator >(const ConcurrentVectorIterator& other) const {
+				return m_uIndex > other.m_uIndex;
+			}
+
+			bool operator >=(const ConcurrentVectorIterator& other) const {
+				return m_uIndex >= other.m_uIndex;
+			}
+
+			friend ConcurrentVectorIterator operator +(difference_type iOffset, const ConcurrentVectorIterator& itr) {
+				return itr + iOffset;
+			}
+
+		private:
+			template<typename, bool>
+			friend class ConcurrentVectorIterator;
+
+		private:
+			VectorPtr m_pVector = nullptr;
+			size_t	  m_uIndex	= 0;
+	};
+
+	// Append-only vector any number of threads can grow at once. Appending reserves indices with a single fetch-add
+	// and constructs the elements in segments of doubling size that are allocated once and never move, so references
+	// and iterators stay valid while other threads append.
+	// Elements are published in index order: size() only covers the prefix whose elements are all constructed, which
+	// readers may iterate concurrently with appends. Each appender marks its elements ready and then pushes the
+	// published prefix forward as far as the ready marks go, so nobody waits for a slower appender.
+	// Appends construct a temporary first whenever the element constructor may throw, so a reserved index always
+	// ends up holding an element. Only a failed segment allocation leaves reserved indices unpublished for good
+	template<typename T, typename Alloc = Allocator<T>>
+	class ConcurrentVector {
+		static_assert(std::is_nothrow_move_constructible_v<T>, "ConcurrentVector elements have to be nothrow move constructible");
+
+		public:
+			using ValueType		= T;
+			using Iterator		= ConcurrentVectorIterator<ConcurrentVector, false>;
+			using ConstIterator = ConcurrentVectorIterator<ConcurrentVector, true>;
+
+		public:
+			ConcurrentVector() = default;
+
+			ConcurrentVector(const ConcurrentVector&) = delete;
+			ConcurrentVector& operator =(const ConcurrentVector&) = delete;
+
+			// Must not race with any other call
+			~ConcurrentVector() {
+				clear();
+
+				for (size_t i = 0; i < SEGMENT_COUNT; ++i) {
+					T* pSegment = m_pSegments[i].load(std::memory_order_relaxed);
+
+					if (pSegment)
+						m_Allocator.deallocate(pSegment, SegmentAllocation(i));
+				}
+			}
+
+			void push_back(const T& value) {
+				emplace_back(value);
+			}
+
+			void push_back(T&& value) {
+				emplace_back(std::move(value));
+			}
+
+			// Appends T(args...) and returns it. The element may not be published yet when this returns if an earlier
+			// index is still being constructed
+			template<typename... Args>
+			T& emplace_back(Args&&... args) {
+				if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+					return emplace_back(T(std::forward<Args>(args)...));
+				}
+				else {
+					size_t uIndex = m_uReserved.fetch_add(1, std::memory_order_relaxed);
+					T*	   pSlot  = SlotForWrite(uIndex);
+
+					new(pSlot) T(std::forward<Args>(args)...);
+					Publish(uIndex, 1);
+
+					return *pSlot;
+				}
+			}
+
+			// Appends uCount default constructed elements. Returns the index of the first one
+			size_t grow_by(size_t uCount) {
+				if constexpr (!std::is_nothrow_default_constructible_v<T>) {
+					Vector<T> values(uCount);
+
+					return GrowBy(uCount, [&](T* pSlot, size_t i) { new(pSlot) T(std::move(values[i])); });
+				}
+				else {
+					return GrowBy(uCount, [](T* pSlot, size_t) { new(pSlot) T(); });
+				}
+			}
+
+			// Appends uCount copies of value. Returns the index of the first one
+			size_t grow_by(size_t uCount, const T& value) {
+				if constexpr (!std::is_nothrow_copy_constructible_v<T>) {
+					Vector<T> values(uCount, value);
+
+					return GrowBy(uCount, [&](T* pSlot, size_t i) { new(pSlot) T(std::move(values[i])); });
+				}
+				else {
+					return GrowBy(uCount, [&](T* pSlot, size_t) { new(pSlot) T(value); });
+				}
+			}
+
+			// Allocates the segments up to uCapacity elements ahead of time
+			void reserve(size_t uCapacity) {
+				for (size_t i = 0; i < SEGMENT_COUNT && SegmentBase(i) < uCapacity; ++i)
+					Segment(i);
+			}
+
+			// Returns the element at index uIndex, which has to be below size()
+			T& operator [](size_t uIndex) {
+				return *Slot(uIndex);
+			}
+
+			const T& operator [](size_t uIndex) const {
+				return *Slot(uIndex);
+			}
+
+			// Returns the element at index uIndex, throws std::out_of_range if it isn't published
+			T& at(size_t uIndex) {
+				if (uIndex >= size())
+					throw std::out_of_range("Index out of range");
+
+				return *Slot(uIndex);
+			}
+
+			const T& at(size_t uIndex) const {
+				if (uIndex >= size())
+					throw std::out_of_range("Index out of range");
+
+				return *Slot(uIndex);
+			}
+
+			// Number of published elements, every index below it can be read
+			size_t size() const {
+				return m_uPublished.load(std::memory_order_acquire);
+			}
+
+			bool empty() const {
+				return size() == 0;
+			}
+
+			// Iterators cover the elements published when begin/end were called
+			Iterator begin() {
+				return Iterator(this, 0);
+			}
+
+			ConstIterator begin() const {
+				return ConstIterator(this, 0);
+			}
+
+			Iterator end() {
+				return Iterator(this, size());
+			}
+
+			ConstIterator end() const {
+				return ConstIterator(this, size());
+			}
+
+			// Destroys every element and keeps the segments. Must not race with any other call
+			void clear() {
+				size_t uSize = m_uReserved.load(std::memory_order_relaxed);
+
+				for (size_t i = 0; i < uSize; ++i) {
+					if (ReadyFlag(i).exchange(0, std::memory_order_relaxed))
+						Slot(i)->~T();
+				}
+
+				m_uReserved.store(0, std::memory_order_relaxed);
+				m_uPublished.store(0, std::memory_order_relaxed);
+			}
+
+		private:
+			using ReadyType = std::atomic<uint8_t>;
+
+			// Segment i holds FIRST_SEGMENT_SIZE << i elements, enough segments to span the whole index range
+			static constexpr size_t FIRST_SEGMENT_SIZE = 32;
+			static constexpr size_t FIRST_SEGMENT_LOG  = std::countr_zero(FIRST_SEGMENT_SIZE);
+			static constexpr size_t SEGMENT_COUNT	   = 64 - FIRST_SEGMENT_LOG;
+
+			static size_t SegmentSize(size_t uSegment) {
+				return FIRST_SEGMENT_SIZE << uSegment;
+			}
+
+			static size_t SegmentBase(size_t uSegment) {
+				return SegmentSize(uSegment) - FIRST_SEGMENT_SIZE;
+			}
+
+			// A segment's ready flags live in the same allocation, right after its elements
+			static size_t SegmentAllocation(size_t uSegment) {
+				size_t uSize = SegmentSize(uSegment);
+
+				return uSize + (uSize * sizeof(ReadyType) + sizeof(T) - 1) / sizeof(T);
+			}
+
+			// Offsetting indices by the first segment's size makes the segment the position of the highest set bit
+			static std::pair<size_t, size_t> Locate(size_t uIndex) {
+				size_t uShifted = uIndex + FIRST_SEGMENT_SIZE;
+				size_t uSegment = std::bit_width(uShifted) - 1 - FIRST_SEGMENT_LOG;
+
+				return { uSegment, uShifted - SegmentSize(uSegment) };
+			}
+
+			// Returns the segment, allocating it if needed. Racing appenders each allocate one and the losers free theirs
+			T* Segment(size_t uSegment) {
+				T* pSegment = m_pSegments[uSegment].load(std::memory_order_acquire);
+
+				if (pSegment)
+					return pSegment;
+
+				size_t	   uSize  = SegmentSize(uSegment);
+				T*		   pNew	  = m_Allocator.allocate(SegmentAllocation(uSegment));
+				ReadyType* pReady = reinterpret_cast<ReadyType*>(pNew + uSize);
+
+				for (size_t i = 0; i < uSize; ++i)
+					new(pReady + i) ReadyType(0);
+
+				if (m_pSegments[uSegment].compare_exchange_strong(pSegment, pNew, std::memory_order_acq_rel, std::memory_order_acquire))
+					return pNew;
+
+				m_Allocator.deallocate(pNew, SegmentAllocation(uSegment));
+
+				return pSegment;
+			}
+
+			T* SlotForWrite(size_t uIndex) {
+				auto [uSegment, uOffset] = Locate(uIndex);
+
+				return Segment(uSegment) + uOffset;
+			}
+
+			T* Slot(size_t uIndex) const {
+				auto [uSegment, uOffset] = Locate(uIndex);
+
+				return m_pSegments[uSegment].load(std::memory_order_acquire) + uOffset;
+			}
+
+			ReadyType& ReadyFlag(size_t uIndex) const {
+				auto [uSegment, uOffset] = Locate(uIndex);
+
+				return reinterpret_cast<ReadyType*>(m_pSegments[uSegment].load(std::memory_order_acquire) + SegmentSize(uSegment))[uOffset];
+			}
+
+			template<typename Construct>
+			size_t GrowBy(size_t uCount, Construct&& construct) {
+				size_t uFirst = m_uReserved.fetch_add(uCount, std::memory_order_relaxed);
+
+				for (size_t i = 0; i < uCount; ++i)
+					construct(SlotForWrite(uFirst + i), i);
+
+				Publish(uFirst, uCount);
+
+				return uFirst;
+			}
+
+			// Marks [uFirst; uFirst + uCount) ready, then moves the published prefix over every ready element. Whoever
+			// publishes an index sees the ready mark of the next one or its owner sees the new prefix, so none is missed
+			void Publish(size_t uFirst, size_t uCount) {
+				size_t uLast = uFirst + uCount;
+
+				for (size_t i = uFirst; i < uLast; ++i)
+					ReadyFlag(i).store(1, std::memory_order_release);
+
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				size_t uPublished = m_uPublished.load(std::memory_order_relaxed);
+
+				while (IsReady(uPublished)) {
+					// Our own elements go in one step
+					size_t uNext = uPublished >= uFirst && uPublished < uLast ? uLast : uPublished + 1;
+
+					if (m_uPublished.compare_exchange_weak(uPublished, uNext, std::memory_order_seq_cst, std::memory_order_relaxed))
+						uPublished = uNext;
+				}
+			}
+
+			// The segment of an index reserved by a slower appender may not even be allocated yet
+			bool IsReady(size_t uIndex) const {
+				if (uIndex >= m_uReserved.load(std::memory_order_relaxed))
+					return false;
+
+				auto [uSegment, uOffset] = Locate(uIndex);
+				T*	 pSegment			 = m_pSegments[uSegment].load(std::memory_order_acquire);
+
+				return pSegment && reinterpret_cast<ReadyType*>(pSegment + SegmentSize(uSegment))[uOffset].load(std::memory_order_seq_cst);
+			}
+
+		private:
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_uReserved  = 0;
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_uPublished = 0;
+			alignas(CACHE_LINE_SIZE) std::atomic<T*>	  m_pSegments[SEGMENT_COUNT] = {};
+
+			Alloc m_Allocator;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+
+#include "../Memory/Memory.hpp"
+#include "../Containers/Vector.hpp"
+
+namespace nstd {
+	class EpochDomain;
+
+	// Keeps the calling thread inside an epoch of its domain. While the guard lives, nothing retired through the
+	// domain after the guard was taken gets freed, so pointers read from a shared structure stay valid
+	class EpochGuard {
+		public:
+			EpochGuard(const EpochGuard&) = delete;
+			EpochGuard& operator =(const EpochGuard&) = delete;
+
+			EpochGuard(EpochGuard&& other) noexcept
+				: m_pDomain(other.m_pDomain), m_pRecord(other.m_pRecord) {
+				other.m_pRecord = nullptr;
+			}
+
+			inline ~EpochGuard();
+
+			// Hands pObject over to the domain, which calls pfnReclaim(pObject) once no thread can still be reading it
+			inline void retire(void* pObject, void (*pfnReclaim)(void*));
+
+			// Retires pObject, which was allocated through Alloc. It will be destroyed and deallocated by a default
+			// constructed Alloc, so the allocator has to be stateless
+			template<typename Alloc, typename T>
+			void retire(T* pObject) {
+				retire(pObject, [](void* pPtr) {
+					Alloc alloc;
+					T*	  pTyped = static_cast<T*>(pPtr);
+
+					alloc.destroy(pTyped);
+					alloc.deallocate(pTyped, 1);
+				});
+			}
+
+		private:
+			friend class EpochDomain;
+
+			EpochGuard(EpochDomain* pDomain, void* pRecord)
+				: m_pDomain(pDomain), m_pRecord(pRecord) { }
+
+		private:
+			EpochDomain* m_pDomain;
+			void*		 m_pRecord;
+	};
+
+	// Epoch-based memory reclamation for lock-free structures. Readers pin the current epoch with an EpochGuard
+	// before touching shared nodes, and unlinked nodes are retired instead of freed. The global epoch only moves on
+	// once every pinned thread has caught up with it, so a node retired in epoch e is unreachable by anyone once the
+	// epoch reached e + 2 and gets freed then. Since a node is never reused while a reader may hold it, this also
+	// rules out ABA on compare-and-swap of node pointers.
+	// Threads borrow a per-domain record (their pin slot and retired lists) for the lifetime of a guard, so the
+	// domain needs no registration and works with threads coming and going. Pinning costs one uncontended CAS and
+	// a fence
+	class EpochDomain {
+		public:
+			EpochDomain()
+				: m_uId(s_uNextId.fetch_add(1, std::memory_order_relaxed)) { }
+
+			EpochDomain(const EpochDomain&) = delete;
+			EpochDomain& operator =(const EpochDomain&) = delete;
+
+			// No guard may outlive the domain. Frees everything still retired
+			~EpochDomain() {
+				Record* pRecord = m_pRecords.load(std::memory_order_acquire);
+
+				while (pRecord) {
+					Record* pNext = pRecord->pNext;
+
+					for (size_t i = 0; i < 3; ++i)
+						Reclaim(pRecord->Retired[i]);
+
+					m_Allocator.destroy(pRecord);
+					m_Allocator.deallocate(pRecord, 1);
+
+					pRecord = pNext;
+				}
+			}
+
+			// Enters the current epoch. Guards may nest, each one borrows its own record
+			EpochGuard pin() {
+				Record* pRecord = Acquire();
+
+				pRecord->uEpoch.store(m_uEpoch.load(std::memory_order_seq_cst), std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				return EpochGuard(this, pRecord);
+			}
+
+			// Tries to advance the epoch and frees whatever became safe in the records no thread is using right now.
+			// Retiring already does this every so often, calling it helps to bound memory once a structure goes quiet
+			void collect() {
+				TryAdvance();
+
+				uint64_t uEpoch = m_uEpoch.load(std::memory_order_seq_cst);
+
+				for (Record* pRecord = m_pRecords.load(std::memory_order_acquire); pRecord; pRecord = pRecord->pNext) {
+					bool bExpected = false;
+
+					if (pRecord->bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acquire)) {
+						Collect(pRecord, uEpoch);
+						pRecord->bInUse.store(false, std::memory_order_release);
+					}
+				}
+			}
+
+		private:
+			friend class EpochGuard;
+
+			struct RetiredObject {
+				void* pObject;
+				void  (*pfnReclaim)(void*);
+			};
+
+			// Records are allocated one by one and span a few cache lines, so the pin slots of different records
+			// don't share a line
+			struct Record {
+				std::atomic<uint64_t> uEpoch = 0; // Epoch the owner is pinned in, 0 while unpinned
+				std::atomic<bool>	  bInUse = false;
+				Record*				  pNext	 = nullptr;
+
+				// Nodes retired in the last three epochs, by epoch modulo 3
+				Vector<RetiredObject> Retired[3];
+				uint64_t			  uRetiredEpochs[3] = {};
+				size_t				  uRetiredCount		= 0;
+			};
+
+			using RecordAllocator = Allocator<Record>;
+
+			// Retired nodes a record gathers before trying to advance the epoch
+			static constexpr size_t COLLECT_THRESHOLD = 64;
+
+			// Reuses the record this thread last borrowed from this domain if it is free, otherwise the first free one,
+			// and only adds a record when all of them are taken
+			Record* Acquire() {
+				Record* pRecord = s_LastRecord.uDomainId == m_uId ? static_cast<Record*>(s_LastRecord.pRecord) : nullptr;
+
+				if (!pRecord || !TryTake(pRecord)) {
+					pRecord = m_pRecords.load(std::memory_order_acquire);
+
+					while (pRecord && !TryTake(pRecord))
+						pRecord = pRecord->pNext;
+
+					if (!pRecord) {
+						pRecord = m_Allocator.allocate(1);
+						m_Allocator.construct(pRecord);
+						pRecord->bInUse.store(true, std::memory_order_relaxed);
+						pRecord->pNext = m_pRecords.load(std::memory_order_relaxed);
+
+						while (!m_pRecords.compare_exchange_weak(pRecord->pNext, pRecord, std::memory_order_release, std::memory_order_relaxed));
+					}
+
+					s_LastRecord = { m_uId, pRecord };
+				}
+
+				return pRecord;
+			}
+
+			static bool TryTake(Record* pRecord) {
+				bool bExpected = false;
+
+				return !pRecord->bInUse.load(std::memory_order_relaxed)
+					&& pRecord->bInUse.compare_exchange_strong(bExpected, true, std::memory_order_acquire);
+			}
+
+			static void Release(Record* pRecord) {
+				pRecord->uEpoch.store(0, std::memory_order_release);
+				pRecord->bInUse.store(false, std::memory_order_release);
+			}
+
+			void Retire(Record* pRecord, void* pObject, void (*pfnReclaim)(void*)) {
+				uint64_t uEpoch	 = m_uEpoch.load(std::memory_order_seq_cst);
+				size_t	 uBucket = uEpoch % 3;
+
+				// A bucket is only reused three epochs later, by then its nodes are safe to free
+				if (pRecord->uRetiredEpochs[uBucket] != uEpoch) {
+					pRecord->uRetiredCount -= pRecord->Retired[uBucket].size();
+					Reclaim(pRecord->Retired[uBucket]);
+					pRecord->uRetiredEpochs[uBucket] = uEpoch;
+				}
+
+				pRecord->Retired[uBucket].push_back({ pObject, pfnReclaim });
+
+				if (++pRecord->uRetiredCount >= COLLECT_THRESHOLD) {
+					TryAdvance();
+					Collect(pRecord, m_uEpoch.load(std::memory_order_seq_cst));
+				}
+			}
+
+			// Moves the epoch on if every pinned record is in the current one
+			void TryAdvance() {
+				uint64_t uEpoch = m_uEpoch.load(std::memory_order_seq_cst);
+
+				for (Record* pRecord = m_pRecords.load(std::memory_order_acquire); pRecord; pRecord = pRecord->pNext) {
+					uint64_t uPinned = pRecord->uEpoch.load(std::memory_order_seq_cst);
+
+					if (uPinned != 0 && uPinned != uEpoch)
+						return;
+				}
+
+				m_uEpoch.compare_exchange_strong(uEpoch, uEpoch + 1, std::memory_order_seq_cst);
+			}
+
+			// Frees the buckets of a record retired at least two epochs before uEpoch
+			static void Collect(Record* pRecord, uint64_t uEpoch) {
+				for (size_t i = 0; i < 3; ++i) {
+					if (pRecord->uRetiredEpochs[i] + 2 <= uEpoch) {
+						pRecord->uRetiredCount -= pRecord->Retired[i].size();
+						Reclaim(pRecord->Retired[i]);
+					}
+				}
+			}
+
+			static void Reclaim(Vector<RetiredObject>& retired) {
+				for (size_t i = 0; i < retired.size(); ++i)
+					retired[i].pfnReclaim(retired[i].pObject);
+
+				retired.clear();
+			}
+
+		private:
+			// Starts at 1, so 0 can mark unpinned records
+			alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> m_uEpoch = 1;
+			alignas(CACHE_LINE_SIZE) std::atomic<Record*>  m_pRecords = nullptr;
+
+			uint64_t		m_uId;
+			RecordAllocator m_Allocator;
+
+			// Domains get unique ids, so a thread's cached record can't be mistaken for one of a later domain
+			// allocated at the same address
+			struct LastRecord {
+				uint64_t uDomainId;
+				void*	 pRecord;
+			};
+
+			inline static std::atomic<uint64_t>	  s_uNextId	   = 1;
+			inline static thread_local LastRecord s_LastRecord = { 0, nullptr };
+	};
+
+	inline EpochGuard::~EpochGuard() {
+		if (m_pRecord)
+			EpochDomain::Release(static_cast<EpochDomain::Record*>(m_pRecord));
+	}
+
+	inline void EpochGuard::retire(void* pObject, void (*pfnReclaim)(void*)) {
+		m_pDomain->Retire(static_cast<EpochDomain::Record*>(m_pRecord), pObject, pfnReclaim);
+	}
+}
\ No newline at end of file
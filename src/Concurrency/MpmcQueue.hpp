@@ -0,0 +1,314 @@
+#pragma once
+
+#include <bit>
+#include <new>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "../Memory/Memory.hpp"
+
+namespace nstd {
+	// Bounded lock-free queue for any number of producer and consumer threads (Vyukov's array queue).
+	// Every slot carries a sequence number telling whether it is free or full for the current lap of the ring,
+	// so a push or pop claims a position with a single CAS on its own index and then only touches its slot.
+	// Producers and consumers never share a cache line beyond the slots they hand over.
+	// Threads running out of slots (or values) spin briefly and then park on an atomic wait (a futex where the
+	// platform has one). The other side only pays for a wake-up while somebody is parked
+	template<typename T, typename Alloc = Allocator<T>>
+	class MpmcQueue {
+		static_assert(std::is_nothrow_move_constructible_v<T>, "MpmcQueue values have to be nothrow move constructible");
+
+		public:
+			using ValueType = T;
+
+		private:
+			struct Cell {
+				std::atomic<size_t>		 uSequence;
+				alignas(T) unsigned char Storage[sizeof(T)];
+
+				T* Value() {
+					return std::launder(reinterpret_cast<T*>(Storage));
+				}
+			};
+
+			using CellAllocator = typename Alloc::template rebind<Cell>::other;
+
+		public:
+			// uCapacity is rounded up to a power of two
+			explicit MpmcQueue(size_t uCapacity) {
+				m_uCapacity = std::bit_ceil(std::max<size_t>(uCapacity, 2));
+				m_pCells	= m_Allocator.allocate(m_uCapacity);
+
+				for (size_t i = 0; i < m_uCapacity; ++i)
+					new(&m_pCells[i].uSequence) std::atomic<size_t>(i);
+			}
+
+			MpmcQueue(const MpmcQueue&) = delete;
+			MpmcQueue& operator =(const MpmcQueue&) = delete;
+
+			// Must not race with any other call
+			~MpmcQueue() {
+				size_t uEnd = m_uEnqueuePos.load(std::memory_order_relaxed);
+
+				for (size_t uPos = m_uDequeuePos.load(std::memory_order_relaxed); uPos != uEnd; ++uPos)
+					CellAt(uPos).Value()->~T();
+
+				m_Allocator.deallocate(m_pCells, m_uCapacity);
+			}
+
+			// Copies value into the queue. Returns false if the queue is full
+			bool try_push(const T& value) {
+				return TryEmplace(value);
+			}
+
+			// Moves value into the queue. Returns false and leaves value untouched if the queue is full
+			bool try_push(T&& value) {
+				return TryEmplace(std::move(value));
+			}
+
+			// Constructs T(args...) in place. Returns false if the queue is full
+			template<typename... Args>
+			bool try_emplace(Args&&... args) {
+				return TryEmplace(std::forward<Args>(args)...);
+			}
+
+			// Copies value into the queue, waiting for a free slot
+			void push(const T& value) {
+				emplace(value);
+			}
+
+			// Moves value into the queue, waiting for a free slot
+			void push(T&& value) {
+				emplace(std::move(value));
+			}
+
+			// Constructs T(args...) in place, waiting for a free slot
+			template<typename... Args>
+			void emplace(Args&&... args) {
+				if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+					T value(std::forward<Args>(args)...);
+
+					Park(m_uPopEpoch, m_uParkedProducers, [&]() { return TryEmplace(std::move(value)); });
+				}
+				else {
+					Park(m_uPopEpoch, m_uParkedProducers, [&]() { return TryEmplace(std::forward<Args>(args)...); });
+				}
+			}
+
+			// Copies value into the queue, waiting up to timeout for a free slot. Returns false if none came up
+			template<typename Rep, typename Period>
+			bool try_push_for(const T& value, const std::chrono::duration<Rep, Period>& timeout) {
+				return Poll(std::chrono::steady_clock::now() + timeout, [&]() { return TryEmplace(value); });
+			}
+
+			// Moves value into the queue, waiting up to timeout for a free slot.
+			// Returns false and leaves value untouched if none came up
+			template<typename Rep, typename Period>
+			bool try_push_for(T&& value, const std::chrono::duration<Rep, Period>& timeout) {
+				return Poll(std::chrono::steady_clock::now() + timeout, [&]() { return TryEmplace(std::move(value)); });
+			}
+
+			// Moves the oldest value out of the queue into value. Returns false if the queue is empty
+			bool try_pop(T& value) {
+				return TryPop(value);
+			}
+
+			// Moves the oldest value out of the queue, waiting for one to be pushed
+			T pop() {
+				size_t uPos;
+				Cell*  pCell = nullptr;
+
+				Park(m_uPushEpoch, m_uParkedConsumers, [&]() { return (pCell = Claim(m_uDequeuePos, 1, uPos)) != nullptr; });
+
+				T value(std::move(*pCell->Value()));
+
+				Release(pCell, uPos);
+
+				return value;
+			}
+
+			// Moves the oldest value out of the queue into value, waiting up to timeout for one to be pushed.
+			// Returns false if none came up
+			template<typename Rep, typename Period>
+			bool try_pop_for(T& value, const std::chrono::duration<Rep, Period>& timeout) {
+				return Poll(std::chrono::steady_clock::now() + timeout, [&]() { return TryPop(value); });
+			}
+
+			// Approximate when called concurrently with push/pop
+			size_t size() const {
+				size_t uHead = m_uDequeuePos.load(std::memory_order_relaxed);
+				size_t uTail = m_uEnqueuePos.load(std::memory_order_relaxed);
+
+				return uTail > uHead ? std::min(uTail - uHead, m_uCapacity) : 0;
+			}
+
+			// Approximate when called concurrently with push/pop
+			bool empty() const {
+				return size() == 0;
+			}
+
+			size_t capacity() const {
+				return m_uCapacity;
+			}
+
+		private:
+			// Attempts before a waiting thread parks, or starts sleeping in the timed variants
+			static constexpr size_t SPIN_COUNT = 64;
+
+			Cell& CellAt(size_t uPos) {
+				return m_pCells[uPos & (m_uCapacity - 1)];
+			}
+
+			// Claims the slot at the position of index if its sequence reads position + iLap, i.e. it is free for a
+			// producer (iLap = 0) or holds a value for a consumer (iLap = 1). Returns nullptr if the queue is full or empty
+			Cell* Claim(std::atomic<size_t>& index, intptr_t iLap, size_t& uPos) {
+				uPos = index.load(std::memory_order_relaxed);
+
+				while (true) {
+					Cell&	 cell  = CellAt(uPos);
+					intptr_t iDiff = (intptr_t)cell.uSequence.load(std::memory_order_acquire) - (intptr_t)(uPos + iLap);
+
+					if (iDiff == 0) {
+						if (index.compare_exchange_weak(uPos, uPos + 1, std::memory_order_relaxed))
+							return &cell;
+					}
+					else if (iDiff < 0) {
+						return nullptr;
+					}
+					else {
+						uPos = index.load(std::memory_order_relaxed);
+					}
+				}
+			}
+
+			// A position can't be given back once claimed, so anything that may throw is constructed before claiming
+			template<typename... Args>
+			bool TryEmplace(Args&&... args) {
+				if constexpr (!std::is_nothrow_constructible_v<T, Args&&...>) {
+					return TryEmplace(T(std::forward<Args>(args)...));
+				}
+				else {
+					size_t uPos;
+					Cell*  pCell = Claim(m_uEnqueuePos, 0, uPos);
+
+					if (!pCell)
+						return false;
+
+					new(pCell->Storage) T(std::forward<Args>(args)...);
+					pCell->uSequence.store(uPos + 1, std::memory_order_release);
+					Notify(m_uPushEpoch, m_uParkedConsumers);
+
+					return true;
+				}
+			}
+
+			bool TryPop(T& value) {
+				size_t uPos;
+				Cell*  pCell = Claim(m_uDequeuePos, 1, uPos);
+
+				if (!pCell)
+					return false;
+
+				value = std::move(*pCell->Value());
+				Release(pCell, uPos);
+
+				return true;
+			}
+
+			// Destroys the value in a claimed slot and frees it for the producers of the next lap
+			void Release(Cell* pCell, size_t uPos) {
+				pCell->Value()->~T();
+				pCell->uSequence.store(uPos + m_uCapacity, std::memory_order_release);
+				Notify(m_uPopEpoch, m_uParkedProducers);
+			}
+
+			// Wakes one thread parked on epoch, if any. The fence orders the slot handover before reading the parked
+			// count, pairing with the registration in Park, so either the waiter sees the new slot or we see the waiter
+			void Notify(std::atomic<uint32_t>& epoch, std::atomic<uint32_t>& parked) {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (parked.load(std::memory_order_relaxed) == 0)
+					return;
+
+				epoch.fetch_add(1, std::memory_order_release);
+				epoch.notify_one();
+			}
+
+			// Retries attempt until it succeeds, parking on epoch once spinning didn't help
+			template<typename Attempt>
+			static void Park(std::atomic<uint32_t>& epoch, std::atomic<uint32_t>& parked, Attempt&& attempt) {
+				for (size_t i = 0; i < SPIN_COUNT; ++i) {
+					if (attempt())
+						return;
+
+					std::this_thread::yield();
+				}
+
+				while (true) {
+					uint32_t uEpoch = epoch.load(std::memory_order_acquire);
+
+					parked.fetch_add(1, std::memory_order_relaxed);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+
+					if (attempt()) {
+						parked.fetch_sub(1, std::memory_order_relaxed);
+
+						return;
+					}
+
+					epoch.wait(uEpoch, std::memory_order_acquire);
+					parked.fetch_sub(1, std::memory_order_relaxed);
+
+					if (attempt())
+						return;
+				}
+			}
+
+			// Retries attempt until it succeeds or the deadline passes. Atomic waits take no timeout, so the timed
+			// variants back off with growing sleeps instead of parking
+			template<typename Attempt>
+			static bool Poll(std::chrono::steady_clock::time_point deadline, Attempt&& attempt) {
+				for (size_t i = 0; i < SPIN_COUNT; ++i) {
+					if (attempt())
+						return true;
+
+					std::this_thread::yield();
+				}
+
+				std::chrono::microseconds sleep(50);
+
+				while (true) {
+					if (attempt())
+						return true;
+
+					auto now = std::chrono::steady_clock::now();
+
+					if (now >= deadline)
+						return false;
+
+					std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(sleep, deadline - now));
+					sleep = std::min(sleep * 2, std::chrono::microseconds(1000));
+				}
+			}
+
+		private:
+			Cell*		  m_pCells;
+			size_t		  m_uCapacity;
+			CellAllocator m_Allocator;
+
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_uEnqueuePos = 0;
+			alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_uDequeuePos = 0;
+
+			alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_uPushEpoch		  = 0;
+			std::atomic<uint32_t>						   m_uParkedConsumers = 0;
+
+			alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> m_uPopEpoch		  = 0;
+			std::atomic<uint32_t>						   m_uParkedProducers = 0;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+#include "../Memory/Memory.hpp"
+
+namespace nstd {
+	// Link embedded in objects that go through an IntrusiveMpscQueue. An object can sit in one queue per hook
+	struct MpscQueueHook {
+		std::atomic<MpscQueueHook*> pNext = nullptr;
+	};
+
+	// Unbounded FIFO of caller-owned objects, pushed from any number of threads and popped by a single consumer
+	// (Vyukov's intrusive MPSC queue). A push is one atomic exchange and one store, so it is wait-free and never
+	// allocates. The queue never frees anything and only the consumer reads nodes, so unlike the Treiber stack
+	// it needs no reclamation: once pop returns an object no producer touches it anymore.
+	// Objects are linked through their Hook member and must stay alive while queued
+	template<typename T, MpscQueueHook T::*Hook>
+	class IntrusiveMpscQueue {
+		public:
+			using ValueType = T;
+
+		public:
+			IntrusiveMpscQueue() {
+				m_pHead.store(&m_Stub, std::memory_order_relaxed);
+				m_pTail = &m_Stub;
+			}
+
+			IntrusiveMpscQueue(const IntrusiveMpscQueue&) = delete;
+			IntrusiveMpscQueue& operator =(const IntrusiveMpscQueue&) = delete;
+
+			// Any thread. Appends pObject, which must not be queued through the same hook already
+			void push(T* pObject) {
+				Push(&(pObject->*Hook));
+			}
+
+			// Consumer only. Removes the oldest object, returns nullptr if the queue is empty.
+			// Also returns nullptr for the short window in which a producer swapped itself in but hasn't linked
+			// its node yet, the object shows up on a later call
+			T* pop() {
+				MpscQueueHook* pTail = m_pTail;
+				MpscQueueHook* pNext = pTail->pNext.load(std::memory_order_acquire);
+
+				if (pTail == &m_Stub) {
+					if (!pNext)
+						return nullptr;
+
+					m_pTail = pNext;
+					pTail	= pNext;
+					pNext	= pNext->pNext.load(std::memory_order_acquire);
+				}
+
+				if (pNext) {
+					m_pTail = pNext;
+
+					return ObjectOf(pTail);
+				}
+
+				if (pTail != m_pHead.load(std::memory_order_acquire))
+					return nullptr;
+
+				// pTail is the last node, put the stub behind it so it can be handed out
+				Push(&m_Stub);
+				pNext = pTail->pNext.load(std::memory_order_acquire);
+
+				if (pNext) {
+					m_pTail = pNext;
+
+					return ObjectOf(pTail);
+				}
+
+				return nullptr;
+			}
+
+			// Consumer only. Exact unless a push is in flight
+			bool empty() const {
+				return m_pTail == &m_Stub && m_Stub.pNext.load(std::memory_order_acquire) == nullptr;
+			}
+
+		private:
+			void Push(MpscQueueHook* pNode) {
+				pNode->pNext.store(nullptr, std::memory_order_relaxed);
+
+				MpscQueueHook* pPrev = m_pHead.exchange(pNode, std::memory_order_acq_rel);
+
+				pPrev->pNext.store(pNode, std::memory_order_release);
+			}
+
+			static T* ObjectOf(MpscQueueHook* pHook) {
+				return owner_of(pHook, Hook);
+			}
+
+		private:
+			// Producers swap themselves in here
+			alignas(CACHE_LINE_SIZE) std::atomic<MpscQueueHook*> m_pHead;
+
+			// Only the consumer reads and writes the tail
+			alignas(CACHE_LINE_SIZE) MpscQueueHook* m_pTail;
+			MpscQueueHook						   m_Stub;
+	};
+}
\ No newline at end of file
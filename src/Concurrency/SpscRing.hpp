@@ -0,0 +1,280 @@
+#pragma once
+
+#include <bit>
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "../Memory/Memory.hpp"
+#include "../Containers/Span.hpp"
+#include "../Containers/Array.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Slots of a ring with a capacity known at compile time, stored inline
+		template<typename T, size_t _Capacity, typename Alloc>
+		class RingStorage {
+			static_assert(_Capacity > 0 && std::has_single_bit(_Capacity), "Ring capacity has to be a power of two");
+
+			public:
+				RingStorage() = default;
+
+				T* Slots() {
+					return m_Slots.data();
+				}
+
+				size_t Capacity() const {
+					return _Capacity;
+				}
+
+			private:
+				Array<T, _Capacity> m_Slots;
+		};
+
+		// Slots of a ring sized at runtime, allocated through Alloc
+		template<typename T, typename Alloc>
+		class RingStorage<T, DYNAMIC_EXTENT, Alloc> {
+			public:
+				explicit RingStorage(size_t uCapacity)
+					: m_uCapacity(std::bit_ceil(std::max<size_t>(uCapacity, 2))) {
+					m_pSlots = m_Allocator.allocate(m_uCapacity);
+
+					size_t i = 0;
+
+					try {
+						for (; i < m_uCapacity; ++i)
+							m_Allocator.construct(m_pSlots + i);
+					}
+					catch (...) {
+						while (i > 0)
+							m_Allocator.destroy(m_pSlots + --i);
+
+						m_Allocator.deallocate(m_pSlots, m_uCapacity);
+
+						throw;
+					}
+				}
+
+				RingStorage(const RingStorage&) = delete;
+				RingStorage& operator =(const RingStorage&) = delete;
+
+				~RingStorage() {
+					for (size_t i = 0; i < m_uCapacity; ++i)
+						m_Allocator.destroy(m_pSlots + i);
+
+					m_Allocator.deallocate(m_pSlots, m_uCapacity);
+				}
+
+				T* Slots() {
+					return m_pSlots;
+				}
+
+				size_t Capacity() const {
+					return m_uCapacity;
+				}
+
+			private:
+				T*	   m_pSlots;
+				size_t m_uCapacity;
+				Alloc  m_Allocator;
+		};
+	}
+
+	// Bounded wait-free queue between exactly one producer thread and one consumer thread.
+	// The producer only writes the tail and the consumer only writes the head, each on its own cache line next to
+	// a private copy of the other index. The copies are refreshed only when the ring looks full (or empty),
+	// so in steady state neither side touches the other's line and every push or pop is a plain store.
+	// Slots are live T objects that get assigned to and moved from, so T has to be default constructible.
+	// The capacity is a power of two, given by _Capacity or at construction when _Capacity is DYNAMIC_EXTENT
+	template<typename T, size_t _Capacity = DYNAMIC_EXTENT, typename Alloc = Allocator<T>>
+	class SpscRing {
+		public:
+			using ValueType = T;
+
+		public:
+			template<size_t _C = _Capacity, std::enable_if_t<_C != DYNAMIC_EXTENT, int> = 0>
+			SpscRing() { }
+
+			// Rounds uCapacity up to a power of two
+			template<size_t _C = _Capacity, std::enable_if_t<_C == DYNAMIC_EXTENT, int> = 0>
+			explicit SpscRing(size_t uCapacity)
+				: m_Storage(uCapacity) { }
+
+			SpscRing(const SpscRing&) = delete;
+			SpscRing& operator =(const SpscRing&) = delete;
+
+			// Producer: copies value into the ring. Returns false if the ring is full
+			bool try_push(const T& value) {
+				return Push(value);
+			}
+
+			// Producer: moves value into the ring. Returns false if the ring is full
+			bool try_push(T&& value) {
+				return Push(std::move(value));
+			}
+
+			// Producer: moves T(args...) into the ring. Returns false if the ring is full
+			template<typename... Args>
+			bool try_emplace(Args&&... args) {
+				return Push(T(std::forward<Args>(args)...));
+			}
+
+			// Producer: copies as many of values as fit into the ring and publishes them at once.
+			// Returns the number of values pushed
+			size_t try_push_n(Span<const T> values) {
+				size_t uPushed = 0;
+
+				while (uPushed < values.size()) {
+					Span<T> slots = reserve_write(values.size() - uPushed);
+
+					if (slots.empty())
+						break;
+
+					std::copy(values.data() + uPushed, values.data() + uPushed + slots.size(), slots.data());
+					uPushed += slots.size();
+					commit(slots.size());
+				}
+
+				return uPushed;
+			}
+
+			// Producer: returns up to uMax free slots, contiguous in memory, to be filled in place and then published
+			// with commit. The span is empty if the ring is full, and shorter than uMax at the wrap-around
+			Span<T> reserve_write(size_t uMax) {
+				size_t uTail = m_Producer.uTail.load(std::memory_order_relaxed);
+				size_t uFree = Capacity() - (uTail - m_Producer.uCachedHead);
+
+				if (uFree < uMax) {
+					m_Producer.uCachedHead = m_Consumer.uHead.load(std::memory_order_acquire);
+					uFree				   = Capacity() - (uTail - m_Producer.uCachedHead);
+				}
+
+				size_t uIndex = uTail & (Capacity() - 1);
+
+				return Span<T>(m_Storage.Slots() + uIndex, std::min({ uMax, uFree, Capacity() - uIndex }));
+			}
+
+			// Producer: publishes the first uCount slots returned by reserve_write
+			void commit(size_t uCount) {
+				m_Producer.uTail.store(m_Producer.uTail.load(std::memory_order_relaxed) + uCount, std::memory_order_release);
+			}
+
+			// Consumer: moves the oldest value out of the ring into value. Returns false if the ring is empty
+			bool try_pop(T& value) {
+				size_t uHead = m_Consumer.uHead.load(std::memory_order_relaxed);
+
+				if (uHead == m_Consumer.uCachedTail) {
+					m_Consumer.uCachedTail = m_Producer.uTail.load(std::memory_order_acquire);
+
+					if (uHead == m_Consumer.uCachedTail)
+						return false;
+				}
+
+				value = std::move(Slot(uHead));
+				m_Consumer.uHead.store(uHead + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			// Consumer: moves up to values.size() of the oldest values out of the ring and frees their slots at once.
+			// Returns the number of values popped
+			size_t try_pop_n(Span<T> values) {
+				size_t uPopped = 0;
+
+				while (uPopped < values.size()) {
+					Span<T> slots = peek_read(values.size() - uPopped);
+
+					if (slots.empty())
+						break;
+
+					std::move(slots.begin(), slots.end(), values.data() + uPopped);
+					uPopped += slots.size();
+					release(slots.size());
+				}
+
+				return uPopped;
+			}
+
+			// Consumer: returns up to uMax of the oldest values, contiguous in memory, to be read in place and then
+			// freed with release. The span is empty if the ring is empty, and shorter than uMax at the wrap-around
+			Span<T> peek_read(size_t uMax = DYNAMIC_EXTENT) {
+				size_t uHead   = m_Consumer.uHead.load(std::memory_order_relaxed);
+				size_t uQueued = m_Consumer.uCachedTail - uHead;
+
+				if (uQueued < uMax) {
+					m_Consumer.uCachedTail = m_Producer.uTail.load(std::memory_order_acquire);
+					uQueued				   = m_Consumer.uCachedTail - uHead;
+				}
+
+				size_t uIndex = uHead & (Capacity() - 1);
+
+				return Span<T>(m_Storage.Slots() + uIndex, std::min({ uMax, uQueued, Capacity() - uIndex }));
+			}
+
+			// Consumer: frees the first uCount slots returned by peek_read
+			void release(size_t uCount) {
+				m_Consumer.uHead.store(m_Consumer.uHead.load(std::memory_order_relaxed) + uCount, std::memory_order_release);
+			}
+
+			// Number of queued values, only exact when called from the producer or consumer while the other is idle
+			size_t size() const {
+				size_t uHead = m_Consumer.uHead.load(std::memory_order_acquire);
+
+				return m_Producer.uTail.load(std::memory_order_acquire) - uHead;
+			}
+
+			bool empty() const {
+				return size() == 0;
+			}
+
+			size_t capacity() const {
+				return m_Storage.Capacity();
+			}
+
+		private:
+			template<typename Value>
+			bool Push(Value&& value) {
+				size_t uTail = m_Producer.uTail.load(std::memory_order_relaxed);
+
+				if (uTail - m_Producer.uCachedHead == Capacity()) {
+					m_Producer.uCachedHead = m_Consumer.uHead.load(std::memory_order_acquire);
+
+					if (uTail - m_Producer.uCachedHead == Capacity())
+						return false;
+				}
+
+				Slot(uTail) = std::forward<Value>(value);
+				m_Producer.uTail.store(uTail + 1, std::memory_order_release);
+
+				return true;
+			}
+
+			size_t Capacity() const {
+				return m_Storage.Capacity();
+			}
+
+			T& Slot(size_t uPos) {
+				return m_Storage.Slots()[uPos & (Capacity() - 1)];
+			}
+
+		private:
+			// Written by the producer, read by the consumer only when its cached tail runs out
+			struct alignas(CACHE_LINE_SIZE) ProducerSide {
+				std::atomic<size_t> uTail		= 0;
+				size_t				uCachedHead = 0;
+			};
+
+			// Written by the consumer, read by the producer only when its cached head runs out
+			struct alignas(CACHE_LINE_SIZE) ConsumerSide {
+				std::atomic<size_t> uHead		= 0;
+				size_t				uCachedTail = 0;
+			};
+
+			ProducerSide m_Producer;
+			ConsumerSide m_Consumer;
+
+			alignas(CACHE_LINE_SIZE) detail::RingStorage<T, _Capacity, Alloc> m_Storage;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,631 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <memory>
+#include <functional>
+#include <exception>
+#include <algorithm>
+#include <type_traits>
+#include <cstdint>
+
+#include "../Memory/Memory.hpp"
+#include "../Containers/Vector.hpp"
+#include "../Containers/Array.hpp"
+#include "../Containers/Span.hpp"
+
+namespace nstd {
+	// Chase-Lev work-stealing deque. The owning thread pushes and pops at the bottom,
+	// any other thread may steal from the top. Grows on demand, retired buffers are kept
+	// until destruction since a thief might still be reading from them
+	template<typename T>
+	class WorkStealingDeque {
+		static_assert(std::is_pointer_v<T>, "WorkStealingDeque can only hold pointers");
+
+		private:
+			struct Buffer {
+				int64_t			iCapacity;
+				std::atomic<T>* pSlots;
+
+				Buffer(int64_t iCap)
+					: iCapacity(iCap), pSlots(new std::atomic<T>[iCap]) { }
+
+				~Buffer() {
+					delete[] pSlots;
+				}
+
+				T Get(int64_t iIndex) const {
+					return pSlots[iIndex & (iCapacity - 1)].load(std::memory_order_relaxed);
+				}
+
+				void Put(int64_t iIndex, T item) {
+					pSlots[iIndex & (iCapacity - 1)].store(item, std::memory_order_relaxed);
+				}
+			};
+
+		public:
+			// uCapacity is rounded up to a power of two
+			explicit WorkStealingDeque(size_t uCapacity = 256) {
+				int64_t iCap = 2;
+
+				while (iCap < (int64_t)uCapacity)
+					iCap <<= 1;
+
+				m_pBuffer.store(new Buffer(iCap), std::memory_order_relaxed);
+			}
+
+			WorkStealingDeque(const WorkStealingDeque&) = delete;
+			WorkStealingDeque& operator =(const WorkStealingDeque&) = delete;
+
+			~WorkStealingDeque() {
+				delete m_pBuffer.load(std::memory_order_relaxed);
+
+				for (Buffer* pBuffer : m_RetiredBuffers)
+					delete pBuffer;
+			}
+
+			// Owner only. Pushes the item at the bottom, doubling the buffer if it's full
+			void push(T item) {
+				int64_t iBottom = m_iBottom.load(std::memory_order_relaxed);
+				int64_t iTop	= m_iTop.load(std::memory_order_acquire);
+				Buffer* pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+
+				if (iBottom - iTop > pBuffer->iCapacity - 1)
+					pBuffer = Grow(pBuffer, iBottom, iTop);
+
+				pBuffer->Put(iBottom, item);
+				std::atomic_thread_fence(std::memory_order_release);
+				m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+			}
+
+			// Owner only. Pops the most recently pushed item, returns nullptr if there is none
+			T pop() {
+				int64_t iBottom = m_iBottom.load(std::memory_order_relaxed) - 1;
+				Buffer* pBuffer = m_pBuffer.load(std::memory_order_relaxed);
+
+				m_iBottom.store(iBottom, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				int64_t iTop = m_iTop.load(std::memory_order_relaxed);
+
+				if (iTop > iBottom) {
+					m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+
+					return nullptr;
+				}
+
+				T item = pBuffer->Get(iBottom);
+
+				// Last element, race the thieves for it
+				if (iTop == iBottom) {
+					if (!m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+						item = nullptr;
+
+					m_iBottom.store(iBottom + 1, std::memory_order_relaxed);
+				}
+
+				return item;
+			}
+
+			// Any thread. Takes the oldest item, returns nullptr if the deque is empty or another thread won the race
+			T steal() {
+				int64_t iTop = m_iTop.load(std::memory_order_acquire);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				int64_t iBottom = m_iBottom.load(std::memory_order_acquire);
+
+				if (iTop >= iBottom)
+					return nullptr;
+
+				T item = m_pBuffer.load(std::memory_order_acquire)->Get(iTop);
+
+				if (!m_iTop.compare_exchange_strong(iTop, iTop + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					return nullptr;
+
+				return item;
+			}
+
+			// Approximate when called concurrently with push/pop/steal
+			bool empty() const {
+				return size() == 0;
+			}
+
+			// Approximate when called concurrently with push/pop/steal
+			size_t size() const {
+				int64_t iBottom = m_iBottom.load(std::memory_order_relaxed);
+				int64_t iTop	= m_iTop.load(std::memory_order_relaxed);
+
+				return iBottom > iTop ? (size_t)(iBottom - iTop) : 0;
+			}
+
+		private:
+			Buffer* Grow(Buffer* pOld, int64_t iBottom, int64_t iTop) {
+				Buffer* pNew = new Buffer(pOld->iCapacity * 2);
+
+				for (int64_t i = iTop; i < iBottom; ++i)
+					pNew->Put(i, pOld->Get(i));
+
+				m_RetiredBuffers.push_back(pOld);
+				m_pBuffer.store(pNew, std::memory_order_release);
+
+				return pNew;
+			}
+
+		private:
+			alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_iTop	 = 0;
+			alignas(CACHE_LINE_SIZE) std::atomic<int64_t> m_iBottom = 0;
+			alignas(CACHE_LINE_SIZE) std::atomic<Buffer*> m_pBuffer = nullptr;
+			std::vector<Buffer*>						  m_RetiredBuffers;
+	};
+
+	class TaskGroup;
+
+	// Pool of worker threads, each owning a work-stealing deque. Tasks spawned from a worker go to
+	// its own deque, tasks spawned from any other thread go to the global injection queue.
+	// Idle workers steal from random victims before going to sleep. Sleeping goes through an eventcount,
+	// so as long as no worker sleeps, pushing and popping touch nothing but the deques
+	class ThreadPool {
+		public:
+			// Creates uThreadCount workers, defaults to one per hardware thread
+			explicit ThreadPool(size_t uThreadCount = std::max(1u, std::thread::hardware_concurrency())) {
+				for (size_t i = 0; i < uThreadCount; ++i)
+					m_Workers.push_back(std::make_unique<Worker>());
+
+				for (size_t i = 0; i < uThreadCount; ++i)
+					m_Workers[i]->Thread = std::thread(&ThreadPool::WorkerLoop, this, i);
+			}
+
+			ThreadPool(const ThreadPool&) = delete;
+			ThreadPool& operator =(const ThreadPool&) = delete;
+
+			// Lets the workers drain every queued task, then joins them
+			~ThreadPool() {
+				{
+					std::lock_guard<std::mutex> lock(m_SleepMutex);
+					m_bStop = true;
+				}
+
+				m_SleepCondition.notify_all();
+
+				for (auto& pWorker : m_Workers)
+					pWorker->Thread.join();
+			}
+
+			// Returns the process-wide pool used by the parallel primitives when none is given
+			static ThreadPool& instance() {
+				static ThreadPool s_Pool;
+
+				return s_Pool;
+			}
+
+			// Returns the number of worker threads
+			size_t thread_count() const {
+				return m_Workers.size();
+			}
+
+		private:
+			friend class TaskGroup;
+
+			struct Task {
+				std::function<void()> Func;
+				TaskGroup*			  pGroup;
+			};
+
+			struct Worker {
+				WorkStealingDeque<Task*> Deque;
+				std::thread				 Thread;
+			};
+
+			// Index of the calling thread's worker, or thread_count() if it doesn't belong to this pool
+			size_t CurrentWorker() const {
+				return s_pCurrentPool == this ? s_uWorkerIndex : m_Workers.size();
+			}
+
+			void Schedule(Task* pTask) {
+				size_t uSelf = CurrentWorker();
+
+				if (uSelf < m_Workers.size()) {
+					m_Workers[uSelf]->Deque.push(pTask);
+				}
+				else {
+					std::lock_guard<std::mutex> lock(m_InjectionMutex);
+					m_InjectionQueue.push_back(pTask);
+					m_iInjected.fetch_add(1, std::memory_order_relaxed);
+				}
+
+				// Pairs with the fence in PrepareWait: either a worker about to sleep finds the task, or it is seen here
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				if (m_iSleepers.load(std::memory_order_relaxed) > 0) {
+					{
+						std::lock_guard<std::mutex> lock(m_SleepMutex);
+						m_uEpoch.fetch_add(1, std::memory_order_release);
+					}
+
+					m_SleepCondition.notify_one();
+				}
+			}
+
+			// Own deque first, then the injection queue, then a sweep over the other workers starting at a random one
+			Task* FindTask(size_t uSelf) {
+				Task* pTask = nullptr;
+
+				if (uSelf < m_Workers.size())
+					pTask = m_Workers[uSelf]->Deque.pop();
+
+				if (!pTask && m_iInjected.load(std::memory_order_relaxed) > 0) {
+					std::lock_guard<std::mutex> lock(m_InjectionMutex);
+
+					if (!m_InjectionQueue.empty()) {
+						pTask = m_InjectionQueue.front();
+						m_InjectionQueue.pop_front();
+						m_iInjected.fetch_sub(1, std::memory_order_relaxed);
+					}
+				}
+
+				if (!pTask && !m_Workers.empty()) {
+					size_t uStart = NextRandom() % m_Workers.size();
+
+					for (size_t i = 0; i < m_Workers.size() && !pTask; ++i) {
+						size_t uVictim = (uStart + i) % m_Workers.size();
+
+						if (uVictim != uSelf)
+							pTask = m_Workers[uVictim]->Deque.steal();
+					}
+				}
+
+				return pTask;
+			}
+
+			// Announces a worker about to sleep and returns the epoch to sleep on. The caller has to look for tasks
+			// once more before calling Sleep, since anything scheduled earlier didn't see it announced
+			uint64_t PrepareWait() {
+				m_iSleepers.fetch_add(1, std::memory_order_relaxed);
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+
+				return m_uEpoch.load(std::memory_order_acquire);
+			}
+
+			void CancelWait() {
+				m_iSleepers.fetch_sub(1, std::memory_order_relaxed);
+			}
+
+			// Blocks until a task is scheduled after PrepareWait returned uEpoch. Returns false once the pool stops
+			bool Sleep(uint64_t uEpoch) {
+				std::unique_lock<std::mutex> lock(m_SleepMutex);
+
+				m_SleepCondition.wait(lock, [this, uEpoch]() { return m_bStop || m_uEpoch.load(std::memory_order_acquire) != uEpoch; });
+				m_iSleepers.fetch_sub(1, std::memory_order_relaxed);
+
+				return !m_bStop;
+			}
+
+			inline void Execute(Task* pTask);
+
+			void WorkerLoop(size_t uIndex) {
+				s_pCurrentPool	= this;
+				s_uWorkerIndex	= uIndex;
+				s_uRandomState += uIndex * 0x9E3779B97F4A7C15ull;
+
+				while (true) {
+					Task* pTask = FindTask(uIndex);
+
+					for (size_t uSpin = 0; !pTask && uSpin < 64; ++uSpin) {
+						std::this_thread::yield();
+						pTask = FindTask(uIndex);
+					}
+
+					if (!pTask) {
+						uint64_t uEpoch = PrepareWait();
+
+						pTask = FindTask(uIndex);
+
+						if (pTask)
+							CancelWait();
+						// Stopping only wakes the workers, they return once they found nothing left to run
+						else if (!Sleep(uEpoch))
+							return;
+					}
+
+					if (pTask)
+						Execute(pTask);
+				}
+			}
+
+			// xorshift64, only used to pick steal victims
+			static size_t NextRandom() {
+				s_uRandomState ^= s_uRandomState << 13;
+				s_uRandomState ^= s_uRandomState >> 7;
+				s_uRandomState ^= s_uRandomState << 17;
+
+				return (size_t)s_uRandomState;
+			}
+
+		private:
+			std::vector<std::unique_ptr<Worker>> m_Workers;
+
+			std::mutex			 m_InjectionMutex;
+			std::deque<Task*>	 m_InjectionQueue;
+			std::atomic<int64_t> m_iInjected = 0; // Lets FindTask skip the mutex while the queue is empty
+
+			// Eventcount: sleepers announce themselves, and wake when the epoch moves on
+			alignas(CACHE_LINE_SIZE) std::atomic<int64_t>  m_iSleepers = 0;
+			std::atomic<uint64_t>						   m_uEpoch	   = 0;
+
+			std::mutex				m_SleepMutex;
+			std::condition_variable m_SleepCondition;
+			bool					m_bStop = false;
+
+			inline static thread_local ThreadPool* s_pCurrentPool  = nullptr;
+			inline static thread_local size_t	   s_uWorkerIndex  = 0;
+			inline static thread_local uint64_t	   s_uRandomState  = 0x2545F4914F6CDD1Dull;
+	};
+
+	// Fork-join scope. Tasks are spawned with run(), wait() blocks until all of them finished,
+	// executing queued tasks of the pool in the meantime instead of idling.
+	// The first exception thrown by a task is rethrown from wait()
+	class TaskGroup {
+		public:
+			explicit TaskGroup(ThreadPool& pool = ThreadPool::instance())
+				: m_Pool(pool) { }
+
+			TaskGroup(const TaskGroup&) = delete;
+			TaskGroup& operator =(const TaskGroup&) = delete;
+
+			// Tasks still reference the group, so it can't go away before they finish
+			~TaskGroup() {
+				Join();
+			}
+
+			// Spawns func as a task of this group
+			template<typename Func>
+			void run(Func&& func) {
+				m_uPending.fetch_add(1, std::memory_order_relaxed);
+				m_Pool.Schedule(new ThreadPool::Task{ std::function<void()>(std::forward<Func>(func)), this });
+			}
+
+			// Helps executing tasks until every task of this group finished, then rethrows the first caught exception
+			void wait() {
+				Join();
+
+				if (m_pException) {
+					std::exception_ptr pException = m_pException;
+
+					m_pException = nullptr;
+					std::rethrow_exception(pException);
+				}
+			}
+
+		private:
+			friend class ThreadPool;
+
+			void Join() {
+				size_t uSelf = m_Pool.CurrentWorker();
+
+				while (m_uPending.load(std::memory_order_acquire) != 0) {
+					ThreadPool::Task* pTask = m_Pool.FindTask(uSelf);
+
+					if (pTask)
+						m_Pool.Execute(pTask);
+					else
+						std::this_thread::yield();
+				}
+			}
+
+			void SetException(std::exception_ptr pException) {
+				std::lock_guard<std::mutex> lock(m_ExceptionMutex);
+
+				if (!m_pException)
+					m_pException = pException;
+			}
+
+		private:
+			ThreadPool&				 m_Pool;
+			std::atomic<size_t>		 m_uPending = 0;
+			std::mutex				 m_ExceptionMutex;
+			std::exception_ptr		 m_pException;
+	};
+
+	// The group is released last, its waiter may destroy it right after the decrement
+	inline void ThreadPool::Execute(Task* pTask) {
+		TaskGroup* pGroup = pTask->pGroup;
+
+		try {
+			pTask->Func();
+		}
+		catch (...) {
+			pGroup->SetException(std::current_exception());
+		}
+
+		delete pTask;
+		pGroup->m_uPending.fetch_sub(1, std::memory_order_release);
+	}
+
+	// Ranges shorter than this never leave the calling thread when no grain is given
+	constexpr size_t PARALLEL_MIN_GRAIN = 2048;
+
+	// Picks a grain giving every thread a few chunks to balance with, but never below PARALLEL_MIN_GRAIN
+	inline size_t adaptive_grain(size_t uCount, const ThreadPool& pool = ThreadPool::instance()) {
+		return std::max(PARALLEL_MIN_GRAIN, uCount / ((pool.thread_count() + 1) * 8));
+	}
+
+	namespace detail {
+		template<typename Func>
+		void ParallelFor(ThreadPool& pool, size_t uBegin, size_t uEnd, size_t uGrain, const Func& func) {
+			if (uEnd - uBegin <= uGrain) {
+				func(uBegin, uEnd);
+
+				return;
+			}
+
+			TaskGroup group(pool);
+
+			// Right halves are spawned, so thieves take the biggest chunks first
+			while (uEnd - uBegin > uGrain) {
+				size_t uMid = uBegin + (uEnd - uBegin) / 2;
+
+				group.run([&pool, uMid, uEnd, uGrain, &func]() { ParallelFor(pool, uMid, uEnd, uGrain, func); });
+				uEnd = uMid;
+			}
+
+			func(uBegin, uEnd);
+			group.wait();
+		}
+
+		template<typename T, typename Map, typename Combine>
+		T ParallelReduce(ThreadPool& pool, size_t uBegin, size_t uEnd, size_t uGrain, const T& identity, const Map& map, const Combine& combine) {
+			if (uEnd - uBegin <= uGrain)
+				return map(uBegin, uEnd, identity);
+
+			size_t uMid = uBegin + (uEnd - uBegin) / 2;
+			T right = identity;
+			TaskGroup group(pool);
+
+			group.run([&]() { right = ParallelReduce(pool, uMid, uEnd, uGrain, identity, map, combine); });
+
+			T left = ParallelReduce(pool, uBegin, uMid, uGrain, identity, map, combine);
+
+			group.wait();
+
+			return combine(std::move(left), std::move(right));
+		}
+	}
+
+	// Calls func(first, last) over disjoint chunks covering [uBegin; uEnd). A uGrain of 0 picks one with adaptive_grain
+	template<typename Func>
+	void parallel_for(size_t uBegin, size_t uEnd, Func&& func, size_t uGrain = 0, ThreadPool& pool = ThreadPool::instance()) {
+		if (uBegin >= uEnd)
+			return;
+
+		if (uGrain == 0)
+			uGrain = adaptive_grain(uEnd - uBegin, pool);
+
+		detail::ParallelFor(pool, uBegin, uEnd, uGrain, func);
+	}
+
+	// Reduces [uBegin; uEnd) by calling map(first, last, identity) over disjoint chunks and merging the partial results
+	// with combine(lhs, rhs). Chunks are combined in order, so combine only needs to be associative
+	template<typename T, typename Map, typename Combine>
+	T parallel_reduce(size_t uBegin, size_t uEnd, const T& identity, Map&& map, Combine&& combine, size_t uGrain = 0, ThreadPool& pool = ThreadPool::instance()) {
+		if (uBegin >= uEnd)
+			return identity;
+
+		if (uGrain == 0)
+			uGrain = adaptive_grain(uEnd - uBegin, pool);
+
+		return detail::ParallelReduce(pool, uBegin, uEnd, uGrain, identity, map, combine);
+	}
+
+	// Runs every func concurrently, the last one on the calling thread, and returns once all of them finished
+	template<typename... Funcs>
+	void parallel_invoke(Funcs&&... funcs) {
+		TaskGroup group;
+		std::function<void()> tasks[] = { std::function<void()>(std::forward<Funcs>(funcs))... };
+		size_t uCount = sizeof...(Funcs);
+
+		for (size_t i = 0; i + 1 < uCount; ++i)
+			group.run(std::move(tasks[i]));
+
+		if (uCount > 0)
+			tasks[uCount - 1]();
+
+		group.wait();
+	}
+
+	// Calls func(element) for every element of the vector, spread over the pool
+	template<typename T, typename Alloc, typename Func>
+	void parallel_for(Vector<T, Alloc>& vec, Func&& func, size_t uGrain = 0) {
+		T* pData = vec.data();
+
+		parallel_for(0, vec.size(), [pData, &func](size_t uFirst, size_t uLast) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				func(pData[i]);
+		}, uGrain);
+	}
+
+	template<typename T, typename Alloc, typename Func>
+	void parallel_for(const Vector<T, Alloc>& vec, Func&& func, size_t uGrain = 0) {
+		const T* pData = vec.data();
+
+		parallel_for(0, vec.size(), [pData, &func](size_t uFirst, size_t uLast) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				func(pData[i]);
+		}, uGrain);
+	}
+
+	// Calls func(element) for every element of the array, spread over the pool
+	template<typename T, size_t _Size, typename Func>
+	void parallel_for(Array<T, _Size>& arr, Func&& func, size_t uGrain = 0) {
+		T* pData = arr.data();
+
+		parallel_for(0, _Size, [pData, &func](size_t uFirst, size_t uLast) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				func(pData[i]);
+		}, uGrain);
+	}
+
+	template<typename T, size_t _Size, typename Func>
+	void parallel_for(const Array<T, _Size>& arr, Func&& func, size_t uGrain = 0) {
+		const T* pData = arr.data();
+
+		parallel_for(0, _Size, [pData, &func](size_t uFirst, size_t uLast) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				func(pData[i]);
+		}, uGrain);
+	}
+
+	// Calls func(element) for every element viewed by the span, spread over the pool
+	template<typename T, size_t _Extent, typename Func>
+	void parallel_for(Span<T, _Extent> span, Func&& func, size_t uGrain = 0) {
+		T* pData = span.data();
+
+		parallel_for(0, span.size(), [pData, &func](size_t uFirst, size_t uLast) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				func(pData[i]);
+		}, uGrain);
+	}
+
+	// Reduces the vector with combine, each thread folding its chunk into a copy of identity first
+	template<typename T, typename Alloc, typename Combine>
+	T parallel_reduce(const Vector<T, Alloc>& vec, const T& identity, Combine&& combine, size_t uGrain = 0) {
+		const T* pData = vec.data();
+
+		return parallel_reduce(0, vec.size(), identity, [pData, &combine](size_t uFirst, size_t uLast, T acc) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				acc = combine(std::move(acc), pData[i]);
+
+			return acc;
+		}, combine, uGrain);
+	}
+
+	// Reduces the array with combine, each thread folding its chunk into a copy of identity first
+	template<typename T, size_t _Size, typename Combine>
+	T parallel_reduce(const Array<T, _Size>& arr, const T& identity, Combine&& combine, size_t uGrain = 0) {
+		const T* pData = arr.data();
+
+		return parallel_reduce(0, _Size, identity, [pData, &combine](size_t uFirst, size_t uLast, T acc) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				acc = combine(std::move(acc), pData[i]);
+
+			return acc;
+		}, combine, uGrain);
+	}
+
+	// Reduces the elements viewed by the span with combine, each thread folding its chunk into a copy of identity first
+	template<typename T, size_t _Extent, typename Combine>
+	std::remove_cv_t<T> parallel_reduce(Span<T, _Extent> span, const std::remove_cv_t<T>& identity, Combine&& combine, size_t uGrain = 0) {
+		using Value = std::remove_cv_t<T>;
+
+		T* pData = span.data();
+
+		return parallel_reduce(0, span.size(), identity, [pData, &combine](size_t uFirst, size_t uLast, Value acc) {
+			for (size_t i = uFirst; i < uLast; ++i)
+				acc = combine(std::move(acc), pData[i]);
+
+			return acc;
+		}, combine, uGrain);
+	}
+}
\ No newline at end of file
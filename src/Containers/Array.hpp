@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <initializer_list>
 
 namespace nstd {
@@ -9,7 +12,17 @@ namespace nstd {
 		public:
 			using ValueType = typename Array::ValueType;
 
+			using iterator_concept	= std::contiguous_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= std::remove_cv_t<ValueType>;
+			using element_type		= ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
 		public:
+			ArrayIterator() = default;
+
 			ArrayIterator(ValueType* ptr)
 				: m_Ptr(ptr) { }
 
@@ -41,95 +54,97 @@ namespace nstd {
 				return itr;
 			}
 
-			ValueType& operator [](size_t uIndex) {
-				return *(m_Ptr + uIndex);
+			ValueType& operator [](difference_type iIndex) const {
+				return *(m_Ptr + iIndex);
 			}
 
-			ValueType* operator ->() {
+			ValueType* operator ->() const {
 				return m_Ptr;
 			}
 
-			ValueType& operator *() {
+			ValueType& operator *() const {
 				return *m_Ptr;
 			}
 
-			size_t operator +(const ArrayIterator& other) {
-				return m_Ptr + other;
-			}
-
-			size_t operator -(const ArrayIterator& other) {
+			difference_type operator -(const ArrayIterator& other) const {
 				return m_Ptr - other.m_Ptr;
 			}
 
-			ArrayIterator operator +(size_t uOffset) {
-				return ArrayIterator(m_Ptr + uOffset);
-			}
-
-			ArrayIterator operator -(size_t uOffset) {
-				return ArrayIterator(m_Ptr - uOffset);
-			}
-
-			ArrayIterator& operator +=(const ArrayIterator& other) {
-				m_Ptr += other.m_Ptr;
-
-				return *this;
+			ArrayIterator operator +(difference_type iOffset) const {
+				return ArrayIterator(m_Ptr + iOffset);
 			}
 
-			ArrayIterator& operator -=(const ArrayIterator& other) {
-				m_Ptr -= other.m_Ptr;
-
-				return *this;
+			ArrayIterator operator -(difference_type iOffset) const {
+				return ArrayIterator(m_Ptr - iOffset);
 			}
 
-			ArrayIterator& operator +=(size_t uOffset) {
-				m_Ptr += uOffset;
+			ArrayIterator& operator +=(difference_type iOffset) {
+				m_Ptr += iOffset;
 
 				return *this;
 			}
 
-			ArrayIterator& operator -=(size_t uOffset) {
-				m_Ptr -= uOffset;
+			ArrayIterator& operator -=(difference_type iOffset) {
+				m_Ptr -= iOffset;
 
 				return *this;
 			}
 
-			bool operator ==(const ArrayIterator& other) {
+			bool operator ==(const ArrayIterator& other) const {
 				return m_Ptr == other.m_Ptr;
 			}
 
-			bool operator !=(const ArrayIterator& other) {
+			bool operator !=(const ArrayIterator& other) const {
 				return m_Ptr != other.m_Ptr;
 			}
 
-			bool operator <(const ArrayIterator& other) {
+			bool operator <(const ArrayIterator& other) const {
 				return m_Ptr < other.m_Ptr;
 			}
 
-			bool operator <=(const ArrayIterator& other) {
+			bool operator <=(const ArrayIterator& other) const {
 				return m_Ptr <= other.m_Ptr;
 			}
 
-			bool operator >(const ArrayIterator& other) {
+			bool operator >(const ArrayIterator& other) const {
 				return m_Ptr > other.m_Ptr;
 			}
 
-			bool operator >=(const ArrayIterator& other) {
+			bool operator >=(const ArrayIterator& other) const {
 				return m_Ptr >= other.m_Ptr;
 			}
 
+			friend ArrayIterator operator +(difference_type iOffset, const ArrayIterator& itr) {
+				return itr + iOffset;
+			}
+
 		private:
-			ValueType* m_Ptr;
+			ValueType* m_Ptr = nullptr;
 	};
-	
+
 	template<typename Array>
 	class ConstArrayIterator {
 		public:
 			using ValueType = typename Array::ValueType;
 
+			using iterator_concept	= std::contiguous_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= std::remove_cv_t<ValueType>;
+			using element_type		= const ValueType;
+			using pointer			= const ValueType*;
+			using reference			= const ValueType&;
+
 		public:
-			ConstArrayIterator(ValueType* ptr)
+			ConstArrayIterator() = default;
+
+			ConstArrayIterator(const ValueType* ptr)
 				: m_Ptr(ptr) { }
 
+			//Every iterator converts to its const counterpart
+			ConstArrayIterator(const ArrayIterator<Array>& itr)
+				: m_Ptr(itr.operator ->()) { }
+
 			ConstArrayIterator& operator ++() {
 				m_Ptr++;
 
@@ -158,8 +173,8 @@ namespace nstd {
 				return itr;
 			}
 
-			const ValueType& operator [](size_t uIndex) const {
-				return *(m_Ptr + uIndex);
+			const ValueType& operator [](difference_type iIndex) const {
+				return *(m_Ptr + iIndex);
 			}
 
 			const ValueType* operator ->() const {
@@ -170,72 +185,60 @@ namespace nstd {
 				return *m_Ptr;
 			}
 
-			size_t operator +(const ConstArrayIterator& other) {
-				return m_Ptr + other;
-			}
-
-			size_t operator -(const ConstArrayIterator& other) {
+			difference_type operator -(const ConstArrayIterator& other) const {
 				return m_Ptr - other.m_Ptr;
 			}
 
-			ConstArrayIterator operator +(size_t uOffset) {
-				return ConstArrayIterator(m_Ptr + uOffset);
+			ConstArrayIterator operator +(difference_type iOffset) const {
+				return ConstArrayIterator(m_Ptr + iOffset);
 			}
 
-			ConstArrayIterator operator -(size_t uOffset) {
-				return ConstArrayIterator(m_Ptr - uOffset);
+			ConstArrayIterator operator -(difference_type iOffset) const {
+				return ConstArrayIterator(m_Ptr - iOffset);
 			}
 
-			ConstArrayIterator& operator +=(const ConstArrayIterator& other) {
-				m_Ptr += other.m_Ptr;
+			ConstArrayIterator& operator +=(difference_type iOffset) {
+				m_Ptr += iOffset;
 
 				return *this;
 			}
 
-			ConstArrayIterator& operator -=(const ConstArrayIterator& other) {
-				m_Ptr -= other.m_Ptr;
-
-				return *this;
-			}
-
-			ConstArrayIterator& operator +=(size_t uOffset) {
-				m_Ptr += uOffset;
-
-				return *this;
-			}
+			ConstArrayIterator& operator -=(difference_type iOffset) {
+				m_Ptr -= iOffset;
 
-			ConstArrayIterator& operator -=(size_t uOffset) {
-				m_Ptr -= uOffset;
-				
 				return *this;
 			}
 
-			bool operator ==(const ConstArrayIterator& other) {
+			bool operator ==(const ConstArrayIterator& other) const {
 				return m_Ptr == other.m_Ptr;
 			}
 
-			bool operator !=(const ConstArrayIterator& other) {
+			bool operator !=(const ConstArrayIterator& other) const {
 				return m_Ptr != other.m_Ptr;
 			}
 
-			bool operator <(const ConstArrayIterator& other) {
+			bool operator <(const ConstArrayIterator& other) const {
 				return m_Ptr < other.m_Ptr;
 			}
 
-			bool operator <=(const ConstArrayIterator& other) {
+			bool operator <=(const ConstArrayIterator& other) const {
 				return m_Ptr <= other.m_Ptr;
 			}
 
-			bool operator >(const ConstArrayIterator& other) {
+			bool operator >(const ConstArrayIterator& other) const {
 				return m_Ptr > other.m_Ptr;
 			}
 
-			bool operator >=(const ConstArrayIterator& other) {
+			bool operator >=(const ConstArrayIterator& other) const {
 				return m_Ptr >= other.m_Ptr;
 			}
 
+			friend ConstArrayIterator operator +(difference_type iOffset, const ConstArrayIterator& itr) {
+				return itr + iOffset;
+			}
+
 		private:
-			ValueType* m_Ptr;
+			const ValueType* m_Ptr = nullptr;
 	};
 }
 
@@ -376,6 +379,14 @@ namespace nstd {
 				return Iterator(m_Data + _Size);
 			}
 
+			ConstIterator begin() const {
+				return ConstIterator(m_Data);
+			}
+
+			ConstIterator end() const {
+				return ConstIterator(m_Data + _Size);
+			}
+
 			Iterator rbegin() {
 				return Iterator(m_Data - 1);
 			}
@@ -384,19 +395,19 @@ namespace nstd {
 				return Iterator(m_Data + _Size - 1);
 			}
 
-			ConstIterator cbegin() {
+			ConstIterator cbegin() const {
 				return ConstIterator(m_Data);
 			}
 
-			ConstIterator cend() {
+			ConstIterator cend() const {
 				return ConstIterator(m_Data + _Size);
 			}
 
-			ConstIterator crbegin() {
+			ConstIterator crbegin() const {
 				return ConstIterator(m_Data - 1);
 			}
 
-			ConstIterator crend() {
+			ConstIterator crend() const {
 				return ConstIterator(m_Data + _Size - 1);
 			}
 
@@ -502,4 +513,4 @@ namespace std {
 	const T&& get(const nstd::Array<T, _Size>&& arr) {
 		return arr.at(_Index);
 	}
-}
+}
\ No newline at end of file
@@ -0,0 +1,1248 @@
+#pragma once
+
+#include <bit>
+#include <new>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#include "Vector.hpp"
+#include "../Memory/Memory.hpp"
+#include "../Ranges/Views.hpp"
+#include "../Algorithms/Search.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Bytes of keys held by a node, a few cache lines so every node visited pays for several misses at most
+		constexpr size_t BTREE_NODE_BYTES = 4 * CACHE_LINE_SIZE;
+
+		// Keys compared with the built-in < are searched by counting the smaller ones with SIMD compares,
+		// which touches the whole node but never branches on the data
+		template<typename K, typename Compare>
+		inline constexpr bool BTREE_SIMD_SEARCH = std::is_arithmetic_v<K> && (std::is_same_v<Compare, std::less<K>> || std::is_same_v<Compare, std::less<>>);
+
+		// Returns the number of the uCount keys at pKeys that are smaller than key
+		template<typename K>
+		size_t CountLess(const K* pKeys, size_t uCount, K key) {
+			size_t uLess = 0;
+			size_t i	 = 0;
+
+		#ifdef NSTD_HAS_SSE2
+			if constexpr (std::is_same_v<K, float>) {
+				__m128 vKey = _mm_set1_ps(key);
+
+				for (; i + 4 <= uCount; i += 4)
+					uLess += (size_t)std::popcount((unsigned)_mm_movemask_ps(_mm_cmplt_ps(_mm_loadu_ps(pKeys + i), vKey)));
+			}
+			else if constexpr (std::is_same_v<K, double>) {
+				__m128d vKey = _mm_set1_pd(key);
+
+				for (; i + 2 <= uCount; i += 2)
+					uLess += (size_t)std::popcount((unsigned)_mm_movemask_pd(_mm_cmplt_pd(_mm_loadu_pd(pKeys + i), vKey)));
+			}
+			else if constexpr (std::is_integral_v<K> && sizeof(K) == 4) {
+				// SSE2 only compares signed integers, flipping the sign bit maps unsigned order onto signed order
+				const __m128i vBias = _mm_set1_epi32(std::is_signed_v<K> ? 0 : INT32_MIN);
+				const __m128i vKey	= _mm_xor_si128(_mm_set1_epi32((int32_t)key), vBias);
+
+				for (; i + 4 <= uCount; i += 4) {
+					__m128i vKeys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pKeys + i)), vBias);
+
+					uLess += (size_t)std::popcount((unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(vKeys, vKey))));
+				}
+			}
+		#endif
+
+			for (; i < uCount; ++i)
+				uLess += pKeys[i] < key ? 1 : 0;
+
+			return uLess;
+		}
+
+		// Returns the number of the uCount keys at pKeys that are greater than key
+		template<typename K>
+		size_t CountGreater(const K* pKeys, size_t uCount, K key) {
+			size_t uGreater = 0;
+			size_t i		= 0;
+
+		#ifdef NSTD_HAS_SSE2
+			if constexpr (std::is_same_v<K, float>) {
+				__m128 vKey = _mm_set1_ps(key);
+
+				for (; i + 4 <= uCount; i += 4)
+					uGreater += (size_t)std::popcount((unsigned)_mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(pKeys + i), vKey)));
+			}
+			else if constexpr (std::is_same_v<K, double>) {
+				__m128d vKey = _mm_set1_pd(key);
+
+				for (; i + 2 <= uCount; i += 2)
+					uGreater += (size_t)std::popcount((unsigned)_mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(pKeys + i), vKey)));
+			}
+			else if constexpr (std::is_integral_v<K> && sizeof(K) == 4) {
+				const __m128i vBias = _mm_set1_epi32(std::is_signed_v<K> ? 0 : INT32_MIN);
+				const __m128i vKey	= _mm_xor_si128(_mm_set1_epi32((int32_t)key), vBias);
+
+				for (; i + 4 <= uCount; i += 4) {
+					__m128i vKeys = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(pKeys + i)), vBias);
+
+					uGreater += (size_t)std::popcount((unsigned)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(vKeys, vKey))));
+				}
+			}
+		#endif
+
+			for (; i < uCount; ++i)
+				uGreater += key < pKeys[i] ? 1 : 0;
+
+			return uGreater;
+		}
+
+		// Raw storage for the keys or values of a node, constructed and destroyed one by one by the tree
+		template<typename T, size_t _Capacity>
+		class NodeStorage {
+			public:
+				T* Get() {
+					return std::launder(reinterpret_cast<T*>(m_Storage));
+				}
+
+				const T* Get() const {
+					return std::launder(reinterpret_cast<const T*>(m_Storage));
+				}
+
+			private:
+				alignas(T) unsigned char m_Storage[_Capacity * sizeof(T)];
+		};
+
+		template<size_t _Capacity>
+		class NodeStorage<void, _Capacity> { };
+
+		template<typename K, size_t _Capacity>
+		struct BTreeInner;
+
+		template<typename K, size_t _Capacity>
+		struct BTreeNode {
+			BTreeInner<K, _Capacity>*	pParent = nullptr;
+			uint16_t					uCount	= 0;
+			bool						bLeaf;
+			NodeStorage<K, _Capacity>	Keys;
+
+			explicit BTreeNode(bool bIsLeaf)
+				: bLeaf(bIsLeaf) { }
+		};
+
+		// Separators and children: every key of Children[i] is ordered before Keys[i], none is ordered before Keys[i - 1]
+		template<typename K, size_t _Capacity>
+		struct BTreeInner : BTreeNode<K, _Capacity> {
+			BTreeNode<K, _Capacity>* pChildren[_Capacity + 1];
+
+			BTreeInner()
+				: BTreeNode<K, _Capacity>(false) { }
+		};
+
+		// Leaves hold the elements and are chained in key order for range scans
+		template<typename K, typename V, size_t _Capacity>
+		struct BTreeLeaf : BTreeNode<K, _Capacity> {
+			BTreeLeaf*				  pPrev = nullptr;
+			BTreeLeaf*				  pNext = nullptr;
+			NodeStorage<V, _Capacity> Values;
+
+			BTreeLeaf()
+				: BTreeNode<K, _Capacity>(true) { }
+		};
+
+		// What iterators dereference to: the key for sets, a pair of references for maps
+		template<typename K, typename V>
+		struct BTreeReference {
+			using Type = std::pair<const K&, V&>;
+		};
+
+		template<typename K>
+		struct BTreeReference<K, void> {
+			using Type = const K&;
+		};
+
+		template<typename K>
+		struct BTreeReference<K, const void> {
+			using Type = const K&;
+		};
+	}
+
+	template<typename Tree, bool bConst>
+	class BTreeIterator {
+		public:
+			using KeyType	= typename Tree::KeyType;
+			using ValueType = std::conditional_t<bConst, const typename Tree::MappedType, typename Tree::MappedType>;
+			using Reference = typename detail::BTreeReference<KeyType, ValueType>::Type;
+
+			// operator -> can't return the address of a temporary pair, so map iterators return this wrapper instead
+			class ArrowProxy {
+				public:
+					ArrowProxy(Reference ref)
+						: m_Ref(ref) { }
+
+					std::remove_reference_t<Reference>* operator ->() {
+						return &m_Ref;
+					}
+
+				private:
+					Reference m_Ref;
+			};
+
+			using iterator_concept	= std::bidirectional_iterator_tag;
+			using iterator_category = std::conditional_t<std::is_reference_v<Reference>, std::bidirectional_iterator_tag, std::input_iterator_tag>;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename Tree::ValueType;
+			using pointer			= std::conditional_t<std::is_reference_v<Reference>, const KeyType*, ArrowProxy>;
+			using reference			= Reference;
+
+		private:
+			using Leaf = typename Tree::LeafNode;
+
+		public:
+			BTreeIterator() = default;
+
+			BTreeIterator(Leaf* pLeaf, size_t uIndex)
+				: m_pLeaf(pLeaf), m_uIndex(uIndex) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			BTreeIterator(const BTreeIterator<Tree, bOtherConst>& other)
+				: m_pLeaf(other.m_pLeaf), m_uIndex(other.m_uIndex) { }
+
+			BTreeIterator& operator ++() {
+				if (++m_uIndex == m_pLeaf->uCount && m_pLeaf->pNext) {
+					m_pLeaf	 = m_pLeaf->pNext;
+					m_uIndex = 0;
+				}
+
+				return *this;
+			}
+
+			BTreeIterator operator ++(int) {
+				BTreeIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			BTreeIterator& operator --() {
+				if (m_uIndex == 0) {
+					m_pLeaf	 = m_pLeaf->pPrev;
+					m_uIndex = m_pLeaf->uCount;
+				}
+
+				--m_uIndex;
+
+				return *this;
+			}
+
+			BTreeIterator operator --(int) {
+				BTreeIterator itr = *this;
+
+				--(*this);
+
+				return itr;
+			}
+
+			Reference operator *() const {
+				if constexpr (std::is_reference_v<Reference>)
+					return key();
+				else
+					return Reference(key(), value());
+			}
+
+			pointer operator ->() const {
+				if constexpr (std::is_reference_v<Reference>)
+					return &key();
+				else
+					return ArrowProxy(**this);
+			}
+
+			// Returns the key the iterator points to
+			const KeyType& key() const {
+				return m_pLeaf->Keys.Get()[m_uIndex];
+			}
+
+			// Returns the value the iterator points to, only for maps
+			template<typename V = ValueType, std::enable_if_t<!std::is_void_v<V>, int> = 0>
+			V& value() const {
+				return m_pLeaf->Values.Get()[m_uIndex];
+			}
+
+			bool operator ==(const BTreeIterator& other) const {
+				return m_pLeaf == other.m_pLeaf && m_uIndex == other.m_uIndex;
+			}
+
+			bool operator !=(const BTreeIterator& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			template<typename, bool>
+			friend class BTreeIterator;
+
+			friend Tree;
+
+			Leaf*  m_pLeaf	= nullptr;
+			size_t m_uIndex = 0;
+	};
+
+	namespace detail {
+		// B+tree shared by BTreeMap and BTreeSet (V is void for sets). Elements live in the leaves, keys and values
+		// in separate arrays so in-node searches only stream keys, and the leaves are chained so iteration is
+		// a scan of contiguous arrays. Nodes hold BTREE_NODE_BYTES of keys and come from Alloc rebound to the node types.
+		// Inserting or erasing invalidates iterators
+		template<typename K, typename V, typename Compare, typename Alloc>
+		class BTree {
+			public:
+				static constexpr size_t CAPACITY  = std::min<size_t>(std::max<size_t>(BTREE_NODE_BYTES / sizeof(K), 8) & ~(size_t)1, 256);
+				static constexpr size_t MIN_COUNT = CAPACITY / 2;
+
+				using KeyType		= K;
+				using MappedType	= V;
+				using ValueType		= std::conditional_t<std::is_void_v<V>, K, std::pair<const K, std::conditional_t<std::is_void_v<V>, int, V>>>;
+				using Node			= BTreeNode<K, CAPACITY>;
+				using InnerNode		= BTreeInner<K, CAPACITY>;
+				using LeafNode		= BTreeLeaf<K, V, CAPACITY>;
+				using Iterator		= BTreeIterator<BTree, std::is_void_v<V>>;
+				using ConstIterator = BTreeIterator<BTree, true>;
+
+			private:
+				using InnerAllocator = typename Alloc::template rebind<InnerNode>::other;
+				using LeafAllocator	 = typename Alloc::template rebind<LeafNode>::other;
+
+			public:
+				BTree() = default;
+
+				explicit BTree(const Compare& comp)
+					: m_Compare(comp) { }
+
+				BTree(const BTree& other)
+					: m_Compare(other.m_Compare) {
+					BulkLoad(other.begin(), other.m_uSize);
+				}
+
+				BTree(BTree&& other) noexcept {
+					*this = std::move(other);
+				}
+
+				~BTree() {
+					clear();
+				}
+
+				// Clears the current tree, bulk loads a copy of the other one
+				BTree& operator =(const BTree& other) {
+					if (this == &other)
+						return *this;
+
+					clear();
+					m_Compare = other.m_Compare;
+					BulkLoad(other.begin(), other.m_uSize);
+
+					return *this;
+				}
+
+				// Frees the current tree, steals the nodes of the other one and leaves it empty
+				BTree& operator =(BTree&& other) noexcept {
+					if (this == &other)
+						return *this;
+
+					clear();
+
+					m_pRoot	  = other.m_pRoot;
+					m_pFirst  = other.m_pFirst;
+					m_pLast	  = other.m_pLast;
+					m_uSize	  = other.m_uSize;
+					m_Compare = std::move(other.m_Compare);
+
+					other.m_pRoot  = nullptr;
+					other.m_pFirst = nullptr;
+					other.m_pLast  = nullptr;
+					other.m_uSize  = 0;
+
+					return *this;
+				}
+
+				// Returns an iterator to the element with the given key, or end() if there is none
+				Iterator find(const K& key) {
+					return Find(key);
+				}
+
+				ConstIterator find(const K& key) const {
+					return const_cast<BTree*>(this)->Find(key);
+				}
+
+				// Returns true if an element with the given key exists, false otherwise
+				bool contains(const K& key) const {
+					return const_cast<BTree*>(this)->Find(key) != end();
+				}
+
+				// Returns an iterator to the first element whose key isn't ordered before key
+				Iterator lower_bound(const K& key) {
+					return LowerBound(key);
+				}
+
+				ConstIterator lower_bound(const K& key) const {
+					return const_cast<BTree*>(this)->LowerBound(key);
+				}
+
+				// Returns an iterator to the first element whose key is ordered after key
+				Iterator upper_bound(const K& key) {
+					return UpperBound(key);
+				}
+
+				ConstIterator upper_bound(const K& key) const {
+					return const_cast<BTree*>(this)->UpperBound(key);
+				}
+
+				// Returns the elements whose keys lie in [first; last), walked leaf by leaf
+				Subrange<Iterator> range(const K& first, const K& last) {
+					Iterator itr = LowerBound(first);
+
+					return Subrange<Iterator>(itr, m_Compare(first, last) ? LowerBound(last) : itr);
+				}
+
+				Subrange<ConstIterator> range(const K& first, const K& last) const {
+					ConstIterator itr = lower_bound(first);
+
+					return Subrange<ConstIterator>(itr, m_Compare(first, last) ? lower_bound(last) : itr);
+				}
+
+				// Erases the element with the given key, returns the number of erased elements
+				size_t erase(const K& key) {
+					Iterator itr = Find(key);
+
+					if (itr == end())
+						return 0;
+
+					EraseAt(itr.m_pLeaf, itr.m_uIndex);
+
+					return 1;
+				}
+
+				// Erases the element pos points to, returns an iterator to the element after it
+				Iterator erase(ConstIterator pos) {
+					ConstIterator next = std::next(pos);
+
+					if (next == cend()) {
+						EraseAt(pos.m_pLeaf, pos.m_uIndex);
+
+						return end();
+					}
+
+					// Rebalancing may move the next element to another node, find it again by its key
+					K nextKey = next.key();
+
+					EraseAt(pos.m_pLeaf, pos.m_uIndex);
+
+					return LowerBound(nextKey);
+				}
+
+				// Destroys every element and frees every node
+				void clear() {
+					if (m_pRoot)
+						FreeNode(m_pRoot);
+
+					m_pRoot	 = nullptr;
+					m_pFirst = nullptr;
+					m_pLast	 = nullptr;
+					m_uSize	 = 0;
+				}
+
+				void swap(BTree& other) noexcept {
+					std::swap(m_pRoot,	 other.m_pRoot);
+					std::swap(m_pFirst,	 other.m_pFirst);
+					std::swap(m_pLast,	 other.m_pLast);
+					std::swap(m_uSize,	 other.m_uSize);
+					std::swap(m_Compare, other.m_Compare);
+				}
+
+				bool empty() const {
+					return m_uSize == 0;
+				}
+
+				size_t size() const {
+					return m_uSize;
+				}
+
+				Iterator begin() {
+					return Iterator(m_pFirst, 0);
+				}
+
+				Iterator end() {
+					return Iterator(m_pLast, m_pLast ? m_pLast->uCount : 0);
+				}
+
+				ConstIterator begin() const {
+					return ConstIterator(m_pFirst, 0);
+				}
+
+				ConstIterator end() const {
+					return ConstIterator(m_pLast, m_pLast ? m_pLast->uCount : 0);
+				}
+
+				ConstIterator cbegin() const {
+					return begin();
+				}
+
+				ConstIterator cend() const {
+					return end();
+				}
+
+			protected:
+				// Constructs the element from key and args if key isn't present yet, does nothing otherwise
+				template<typename Key, typename... Args>
+				std::pair<Iterator, bool> Emplace(Key&& key, Args&&... args) {
+					if (!m_pRoot) {
+						m_pRoot = m_pFirst = m_pLast = NewLeaf();
+
+						return { Insert(m_pLast, 0, std::forward<Key>(key), std::forward<Args>(args)...), true };
+					}
+
+					LeafNode* pLeaf	 = FindLeaf(key);
+					size_t	  uIndex = LowerBound(pLeaf->Keys.Get(), pLeaf->uCount, key);
+
+					if (uIndex < pLeaf->uCount && !m_Compare(key, pLeaf->Keys.Get()[uIndex]))
+						return { Iterator(pLeaf, uIndex), false };
+
+					return { Insert(pLeaf, uIndex, std::forward<Key>(key), std::forward<Args>(args)...), true };
+				}
+
+				// Replaces the contents with the uCount elements starting at first, which have to be sorted and unique.
+				// Leaves and inner nodes are filled evenly bottom up, in linear time and without a single split
+				template<typename Itr>
+				void BulkLoad(Itr first, size_t uCount) {
+					clear();
+
+					if (uCount == 0)
+						return;
+
+					Vector<Node*> level;
+					Vector<Node*> parents;
+					size_t		  uLeaves = (uCount + CAPACITY - 1) / CAPACITY;
+
+					level.reserve(uLeaves);
+
+					try {
+						for (size_t i = 0; i < uLeaves; ++i) {
+							LeafNode* pLeaf = NewLeaf();
+							size_t	  uFill = uCount / uLeaves + (i < uCount % uLeaves ? 1 : 0);
+
+							pLeaf->pPrev = m_pLast;
+
+							if (m_pLast)
+								m_pLast->pNext = pLeaf;
+							else
+								m_pFirst = pLeaf;
+
+							m_pLast = pLeaf;
+							level.push_back(pLeaf);
+
+							for (; pLeaf->uCount < uFill; ++first) {
+								ConstructElement(pLeaf, pLeaf->uCount, *first);
+								pLeaf->uCount++;
+								m_uSize++;
+							}
+						}
+
+						while (level.size() > 1) {
+							size_t uNodes = (level.size() + CAPACITY) / (CAPACITY + 1);
+							size_t uChild = 0;
+
+							parents.clear();
+							parents.reserve(uNodes);
+
+							for (size_t i = 0; i < uNodes; ++i) {
+								InnerNode* pInner = NewInner();
+								size_t	   uFill  = level.size() / uNodes + (i < level.size() % uNodes ? 1 : 0);
+
+								parents.push_back(pInner);
+
+								for (size_t j = 0; j < uFill; ++j, ++uChild) {
+									if (j > 0) {
+										new(pInner->Keys.Get() + j - 1) K(MinKey(level[uChild]));
+										pInner->uCount++;
+									}
+
+									pInner->pChildren[j]		= level[uChild];
+									level[uChild]->pParent		= pInner;
+								}
+							}
+
+							std::swap(level, parents);
+						}
+
+						m_pRoot = level[0];
+					}
+					catch (...) {
+						// Whatever isn't attached to a parent yet has to be freed on its own
+						for (Node* pNode : parents)
+							FreeNode(pNode);
+
+						for (Node* pNode : level)
+							if (!pNode->pParent)
+								FreeNode(pNode);
+
+						m_pRoot	 = nullptr;
+						m_pFirst = nullptr;
+						m_pLast	 = nullptr;
+						m_uSize	 = 0;
+
+						throw;
+					}
+				}
+
+			private:
+				template<typename Key>
+				size_t LowerBound(const K* pKeys, size_t uCount, const Key& key) const {
+					if constexpr (BTREE_SIMD_SEARCH<K, Compare> && std::is_same_v<Key, K>)
+						return CountLess(pKeys, uCount, key);
+					else
+						return branchless_lower_bound(pKeys, uCount, key, m_Compare);
+				}
+
+				template<typename Key>
+				size_t UpperBound(const K* pKeys, size_t uCount, const Key& key) const {
+					if constexpr (BTREE_SIMD_SEARCH<K, Compare> && std::is_same_v<Key, K>)
+						return uCount - CountGreater(pKeys, uCount, key);
+					else
+						return branchless_upper_bound(pKeys, uCount, key, m_Compare);
+				}
+
+				// Descends to the only leaf that may hold key
+				template<typename Key>
+				LeafNode* FindLeaf(const Key& key) const {
+					Node* pNode = m_pRoot;
+
+					while (!pNode->bLeaf) {
+						InnerNode* pInner = static_cast<InnerNode*>(pNode);
+
+						pNode = pInner->pChildren[UpperBound(pInner->Keys.Get(), pInner->uCount, key)];
+					}
+
+					return static_cast<LeafNode*>(pNode);
+				}
+
+				// Turns a position one past the last element of a leaf into the first element of the next one
+				Iterator Normalize(LeafNode* pLeaf, size_t uIndex) {
+					if (uIndex == pLeaf->uCount && pLeaf->pNext)
+						return Iterator(pLeaf->pNext, 0);
+
+					return Iterator(pLeaf, uIndex);
+				}
+
+				Iterator Find(const K& key) {
+					if (!m_pRoot)
+						return end();
+
+					LeafNode* pLeaf	 = FindLeaf(key);
+					size_t	  uIndex = LowerBound(pLeaf->Keys.Get(), pLeaf->uCount, key);
+
+					if (uIndex == pLeaf->uCount || m_Compare(key, pLeaf->Keys.Get()[uIndex]))
+						return end();
+
+					return Iterator(pLeaf, uIndex);
+				}
+
+				Iterator LowerBound(const K& key) {
+					if (!m_pRoot)
+						return end();
+
+					LeafNode* pLeaf = FindLeaf(key);
+
+					return Normalize(pLeaf, LowerBound(pLeaf->Keys.Get(), pLeaf->uCount, key));
+				}
+
+				Iterator UpperBound(const K& key) {
+					if (!m_pRoot)
+						return end();
+
+					LeafNode* pLeaf = FindLeaf(key);
+
+					return Normalize(pLeaf, UpperBound(pLeaf->Keys.Get(), pLeaf->uCount, key));
+				}
+
+				static const K& MinKey(Node* pNode) {
+					while (!pNode->bLeaf)
+						pNode = static_cast<InnerNode*>(pNode)->pChildren[0];
+
+					return pNode->Keys.Get()[0];
+				}
+
+				template<typename Element>
+				static void ConstructElement(LeafNode* pLeaf, size_t uIndex, Element&& element) {
+					if constexpr (std::is_void_v<V>) {
+						new(pLeaf->Keys.Get() + uIndex) K(std::forward<Element>(element));
+					}
+					else {
+						new(pLeaf->Keys.Get() + uIndex) K(std::forward<Element>(element).first);
+
+						try {
+							new(pLeaf->Values.Get() + uIndex) V(std::forward<Element>(element).second);
+						}
+						catch (...) {
+							pLeaf->Keys.Get()[uIndex].~K();
+
+							throw;
+						}
+					}
+				}
+
+				// Moves uCount constructed elements from pSrc into raw storage at pDst, destroying the sources
+				template<typename T>
+				static void Relocate(T* pDst, T* pSrc, size_t uCount) {
+					for (size_t i = 0; i < uCount; ++i) {
+						new(pDst + i) T(std::move(pSrc[i]));
+						pSrc[i].~T();
+					}
+				}
+
+				// Makes room at uIndex in an array of uCount constructed elements and moves value into it
+				template<typename T>
+				static void InsertInto(T* pArr, size_t uCount, size_t uIndex, T&& value) {
+					if (uIndex == uCount) {
+						new(pArr + uCount) T(std::move(value));
+
+						return;
+					}
+
+					new(pArr + uCount) T(std::move(pArr[uCount - 1]));
+					std::move_backward(pArr + uIndex, pArr + uCount - 1, pArr + uCount);
+					pArr[uIndex] = std::move(value);
+				}
+
+				// Removes the element at uIndex from an array of uCount constructed elements
+				template<typename T>
+				static void EraseFrom(T* pArr, size_t uCount, size_t uIndex) {
+					std::move(pArr + uIndex + 1, pArr + uCount, pArr + uIndex);
+					pArr[uCount - 1].~T();
+				}
+
+				// Inserts the element built from key and args at uIndex of the leaf, splitting it first if it's full
+				template<typename Key, typename... Args>
+				Iterator Insert(LeafNode* pLeaf, size_t uIndex, Key&& key, Args&&... args) {
+					// Built up front, so a throwing constructor leaves the tree untouched
+					K newKey(std::forward<Key>(key));
+
+					std::conditional_t<std::is_void_v<V>, int, V> newValue(std::forward<Args>(args)...);
+
+					if (pLeaf->uCount == CAPACITY) {
+						LeafNode* pRight = SplitLeaf(pLeaf);
+
+						if (uIndex > pLeaf->uCount) {
+							uIndex -= pLeaf->uCount;
+							pLeaf	= pRight;
+						}
+					}
+
+					InsertInto(pLeaf->Keys.Get(), pLeaf->uCount, uIndex, std::move(newKey));
+
+					if constexpr (!std::is_void_v<V>)
+						InsertInto(pLeaf->Values.Get(), pLeaf->uCount, uIndex, std::move(newValue));
+
+					pLeaf->uCount++;
+					m_uSize++;
+
+					return Iterator(pLeaf, uIndex);
+				}
+
+				// Moves the upper half of a full leaf into a new right sibling and links it into the parent
+				LeafNode* SplitLeaf(LeafNode* pLeaf) {
+					LeafNode* pRight = NewLeaf();
+					size_t	  uMove	 = CAPACITY - MIN_COUNT;
+
+					Relocate(pRight->Keys.Get(), pLeaf->Keys.Get() + MIN_COUNT, uMove);
+
+					if constexpr (!std::is_void_v<V>)
+						Relocate(pRight->Values.Get(), pLeaf->Values.Get() + MIN_COUNT, uMove);
+
+					pLeaf->uCount  = (uint16_t)MIN_COUNT;
+					pRight->uCount = (uint16_t)uMove;
+
+					pRight->pPrev = pLeaf;
+					pRight->pNext = pLeaf->pNext;
+
+					if (pLeaf->pNext)
+						pLeaf->pNext->pPrev = pRight;
+					else
+						m_pLast = pRight;
+
+					pLeaf->pNext = pRight;
+
+					InsertIntoParent(pLeaf, K(pRight->Keys.Get()[0]), pRight);
+
+					return pRight;
+				}
+
+				// Adds separator and pRight right after pLeft in their parent, splitting inner nodes up to the root as needed
+				void InsertIntoParent(Node* pLeft, K&& separator, Node* pRight) {
+					InnerNode* pParent = pLeft->pParent;
+
+					if (!pParent) {
+						InnerNode* pRoot = NewInner();
+
+						new(pRoot->Keys.Get()) K(std::move(separator));
+						pRoot->pChildren[0] = pLeft;
+						pRoot->pChildren[1] = pRight;
+						pRoot->uCount		= 1;
+
+						pLeft->pParent	= pRoot;
+						pRight->pParent = pRoot;
+						m_pRoot			= pRoot;
+
+						return;
+					}
+
+					size_t uIndex = ChildIndex(pParent, pLeft);
+
+					if (pParent->uCount == CAPACITY) {
+						// The middle separator moves up, the ones after it go to a new right sibling
+						InnerNode* pSibling = NewInner();
+						size_t	   uMove	= CAPACITY - MIN_COUNT - 1;
+						K		   middle(std::move(pParent->Keys.Get()[MIN_COUNT]));
+
+						pParent->Keys.Get()[MIN_COUNT].~K();
+						Relocate(pSibling->Keys.Get(), pParent->Keys.Get() + MIN_COUNT + 1, uMove);
+
+						for (size_t i = 0; i <= uMove; ++i) {
+							pSibling->pChildren[i]			= pParent->pChildren[MIN_COUNT + 1 + i];
+							pSibling->pChildren[i]->pParent = pSibling;
+						}
+
+						pParent->uCount	 = (uint16_t)MIN_COUNT;
+						pSibling->uCount = (uint16_t)uMove;
+
+						InnerNode* pTarget = pParent;
+
+						if (uIndex > MIN_COUNT) {
+							uIndex -= MIN_COUNT + 1;
+							pTarget = pSibling;
+						}
+
+						InsertChild(pTarget, uIndex, std::move(separator), pRight);
+						InsertIntoParent(pParent, std::move(middle), pSibling);
+
+						return;
+					}
+
+					InsertChild(pParent, uIndex, std::move(separator), pRight);
+				}
+
+				// Inserts separator at uIndex and pChild right after the child at uIndex
+				void InsertChild(InnerNode* pInner, size_t uIndex, K&& separator, Node* pChild) {
+					InsertInto(pInner->Keys.Get(), pInner->uCount, uIndex, std::move(separator));
+					InsertInto(pInner->pChildren, (size_t)pInner->uCount + 1, uIndex + 1, std::move(pChild));
+
+					pInner->uCount++;
+					pChild->pParent = pInner;
+				}
+
+				static size_t ChildIndex(InnerNode* pParent, Node* pChild) {
+					size_t i = 0;
+
+					while (pParent->pChildren[i] != pChild)
+						++i;
+
+					return i;
+				}
+
+				void EraseAt(LeafNode* pLeaf, size_t uIndex) {
+					EraseFrom(pLeaf->Keys.Get(), pLeaf->uCount, uIndex);
+
+					if constexpr (!std::is_void_v<V>)
+						EraseFrom(pLeaf->Values.Get(), pLeaf->uCount, uIndex);
+
+					pLeaf->uCount--;
+					m_uSize--;
+
+					if (pLeaf == m_pRoot) {
+						if (pLeaf->uCount == 0)
+							clear();
+
+						return;
+					}
+
+					if (pLeaf->uCount < MIN_COUNT)
+						RebalanceLeaf(pLeaf);
+				}
+
+				// Refills an underfull leaf from a sibling with elements to spare, or merges it with one
+				void RebalanceLeaf(LeafNode* pLeaf) {
+					InnerNode* pParent = pLeaf->pParent;
+					size_t	   uIndex  = ChildIndex(pParent, pLeaf);
+					LeafNode*  pLeft   = uIndex > 0 ? static_cast<LeafNode*>(pParent->pChildren[uIndex - 1]) : nullptr;
+					LeafNode*  pRight  = uIndex < pParent->uCount ? static_cast<LeafNode*>(pParent->pChildren[uIndex + 1]) : nullptr;
+
+					if (pLeft && pLeft->uCount > MIN_COUNT) {
+						size_t uLast = pLeft->uCount - 1;
+
+						InsertInto(pLeaf->Keys.Get(), pLeaf->uCount, 0, std::move(pLeft->Keys.Get()[uLast]));
+						pLeft->Keys.Get()[uLast].~K();
+
+						if constexpr (!std::is_void_v<V>) {
+							InsertInto(pLeaf->Values.Get(), pLeaf->uCount, 0, std::move(pLeft->Values.Get()[uLast]));
+							pLeft->Values.Get()[uLast].~V();
+						}
+
+						pLeft->uCount--;
+						pLeaf->uCount++;
+						pParent->Keys.Get()[uIndex - 1] = pLeaf->Keys.Get()[0];
+					}
+					else if (pRight && pRight->uCount > MIN_COUNT) {
+						new(pLeaf->Keys.Get() + pLeaf->uCount) K(std::move(pRight->Keys.Get()[0]));
+						EraseFrom(pRight->Keys.Get(), pRight->uCount, 0);
+
+						if constexpr (!std::is_void_v<V>) {
+							new(pLeaf->Values.Get() + pLeaf->uCount) V(std::move(pRight->Values.Get()[0]));
+							EraseFrom(pRight->Values.Get(), pRight->uCount, 0);
+						}
+
+						pRight->uCount--;
+						pLeaf->uCount++;
+						pParent->Keys.Get()[uIndex] = pRight->Keys.Get()[0];
+					}
+					else if (pLeft) {
+						MergeLeaves(pLeft, pLeaf, uIndex - 1);
+					}
+					else {
+						MergeLeaves(pLeaf, pRight, uIndex);
+					}
+				}
+
+				// Moves every element of pRight into pLeft, then drops pRight and the separator at uSeparator between them
+				void MergeLeaves(LeafNode* pLeft, LeafNode* pRight, size_t uSeparator) {
+					Relocate(pLeft->Keys.Get() + pLeft->uCount, pRight->Keys.Get(), pRight->uCount);
+
+					if constexpr (!std::is_void_v<V>)
+						Relocate(pLeft->Values.Get() + pLeft->uCount, pRight->Values.Get(), pRight->uCount);
+
+					pLeft->uCount += pRight->uCount;
+					pRight->uCount = 0;
+
+					pLeft->pNext = pRight->pNext;
+
+					if (pRight->pNext)
+						pRight->pNext->pPrev = pLeft;
+					else
+						m_pLast = pLeft;
+
+					RemoveChild(pLeft->pParent, uSeparator);
+					FreeNode(pRight);
+				}
+
+				// Removes the separator at uSeparator and the child after it, then rebalances the inner node if needed
+				void RemoveChild(InnerNode* pInner, size_t uSeparator) {
+					EraseFrom(pInner->Keys.Get(), pInner->uCount, uSeparator);
+					EraseFrom(pInner->pChildren, (size_t)pInner->uCount + 1, uSeparator + 1);
+					pInner->uCount--;
+
+					if (pInner == m_pRoot) {
+						// A root left with a single child hands the root over to it
+						if (pInner->uCount == 0) {
+							m_pRoot			 = pInner->pChildren[0];
+							m_pRoot->pParent = nullptr;
+							FreeNode(pInner, false);
+						}
+
+						return;
+					}
+
+					if (pInner->uCount < MIN_COUNT)
+						RebalanceInner(pInner);
+				}
+
+				// Rotates a child and separator through the parent from a sibling with some to spare, or merges with one
+				void RebalanceInner(InnerNode* pInner) {
+					InnerNode* pParent = pInner->pParent;
+					size_t	   uIndex  = ChildIndex(pParent, pInner);
+					InnerNode* pLeft   = uIndex > 0 ? static_cast<InnerNode*>(pParent->pChildren[uIndex - 1]) : nullptr;
+					InnerNode* pRight  = uIndex < pParent->uCount ? static_cast<InnerNode*>(pParent->pChildren[uIndex + 1]) : nullptr;
+
+					if (pLeft && pLeft->uCount > MIN_COUNT) {
+						size_t uLast = pLeft->uCount - 1;
+						Node*  pMove = pLeft->pChildren[uLast + 1];
+
+						InsertInto(pInner->Keys.Get(), pInner->uCount, 0, K(std::move(pParent->Keys.Get()[uIndex - 1])));
+						InsertInto(pInner->pChildren, (size_t)pInner->uCount + 1, 0, std::move(pMove));
+						pMove->pParent = pInner;
+						pInner->uCount++;
+
+						pParent->Keys.Get()[uIndex - 1] = std::move(pLeft->Keys.Get()[uLast]);
+						pLeft->Keys.Get()[uLast].~K();
+						pLeft->uCount--;
+					}
+					else if (pRight && pRight->uCount > MIN_COUNT) {
+						Node* pMove = pRight->pChildren[0];
+
+						new(pInner->Keys.Get() + pInner->uCount) K(std::move(pParent->Keys.Get()[uIndex]));
+						pInner->pChildren[pInner->uCount + 1] = pMove;
+						pMove->pParent = pInner;
+						pInner->uCount++;
+
+						pParent->Keys.Get()[uIndex] = std::move(pRight->Keys.Get()[0]);
+						EraseFrom(pRight->Keys.Get(), pRight->uCount, 0);
+						EraseFrom(pRight->pChildren, (size_t)pRight->uCount + 1, 0);
+						pRight->uCount--;
+					}
+					else if (pLeft) {
+						MergeInner(pLeft, pInner, uIndex - 1);
+					}
+					else {
+						MergeInner(pInner, pRight, uIndex);
+					}
+				}
+
+				// Pulls the separator at uSeparator down into pLeft, followed by every separator and child of pRight
+				void MergeInner(InnerNode* pLeft, InnerNode* pRight, size_t uSeparator) {
+					InnerNode* pParent = pLeft->pParent;
+					size_t	   uCount  = pLeft->uCount;
+
+					new(pLeft->Keys.Get() + uCount) K(std::move(pParent->Keys.Get()[uSeparator]));
+					Relocate(pLeft->Keys.Get() + uCount + 1, pRight->Keys.Get(), pRight->uCount);
+
+					for (size_t i = 0; i <= pRight->uCount; ++i) {
+						pLeft->pChildren[uCount + 1 + i]		  = pRight->pChildren[i];
+						pLeft->pChildren[uCount + 1 + i]->pParent = pLeft;
+					}
+
+					pLeft->uCount  = (uint16_t)(uCount + 1 + pRight->uCount);
+					pRight->uCount = 0;
+
+					FreeNode(pRight, false);
+					RemoveChild(pParent, uSeparator);
+				}
+
+				LeafNode* NewLeaf() {
+					LeafNode* pLeaf = m_LeafAllocator.allocate(1);
+
+					return new(pLeaf) LeafNode();
+				}
+
+				InnerNode* NewInner() {
+					InnerNode* pInner = m_InnerAllocator.allocate(1);
+
+					return new(pInner) InnerNode();
+				}
+
+				// Destroys the contents of a node, and of its whole subtree when bRecursive is set, then frees it
+				void FreeNode(Node* pNode, bool bRecursive = true) {
+					K* pKeys = pNode->Keys.Get();
+
+					for (size_t i = 0; i < pNode->uCount; ++i)
+						pKeys[i].~K();
+
+					if (pNode->bLeaf) {
+						LeafNode* pLeaf = static_cast<LeafNode*>(pNode);
+
+						if constexpr (!std::is_void_v<V>)
+							for (size_t i = 0; i < pLeaf->uCount; ++i)
+								pLeaf->Values.Get()[i].~V();
+
+						pLeaf->~LeafNode();
+						m_LeafAllocator.deallocate(pLeaf, 1);
+
+						return;
+					}
+
+					InnerNode* pInner = static_cast<InnerNode*>(pNode);
+
+					if (bRecursive)
+						for (size_t i = 0; i <= pInner->uCount; ++i)
+							FreeNode(pInner->pChildren[i]);
+
+					pInner->~InnerNode();
+					m_InnerAllocator.deallocate(pInner, 1);
+				}
+
+			private:
+				Node*		   m_pRoot	= nullptr;
+				LeafNode*	   m_pFirst = nullptr;
+				LeafNode*	   m_pLast	= nullptr;
+				size_t		   m_uSize	= 0;
+				Compare		   m_Compare;
+				InnerAllocator m_InnerAllocator;
+				LeafAllocator  m_LeafAllocator;
+		};
+	}
+
+	// Ordered map stored as a B+tree of wide nodes: lookups touch a handful of nodes instead of one per level of
+	// a binary tree, and there is no per-element allocation. Arithmetic keys are searched inside nodes with SIMD.
+	// Building from sorted input with sorted_unique is linear, range() walks a key interval leaf by leaf.
+	// Inserting or erasing invalidates iterators and references
+	template<typename K, typename V, typename Compare = std::less<K>, typename Alloc = Allocator<std::pair<const K, V>>>
+	class BTreeMap : public detail::BTree<K, V, Compare, Alloc> {
+		private:
+			using Base = detail::BTree<K, V, Compare, Alloc>;
+
+		public:
+			using typename Base::KeyType;
+			using typename Base::MappedType;
+			using typename Base::ValueType;
+			using typename Base::Iterator;
+			using typename Base::ConstIterator;
+
+		public:
+			BTreeMap() = default;
+
+			explicit BTreeMap(const Compare& comp)
+				: Base(comp) { }
+
+			// Builds the map from an unsorted range of pairs. The first of several equal keys wins
+			template<typename InputItr>
+			BTreeMap(InputItr first, InputItr last, const Compare& comp = Compare{})
+				: Base(comp) {
+				Vector<std::pair<K, V>> pairs;
+
+				for (; first != last; ++first)
+					pairs.emplace_back(first->first, first->second);
+
+				std::stable_sort(pairs.begin(), pairs.end(), [&comp](const std::pair<K, V>& lhs, const std::pair<K, V>& rhs) {
+					return comp(lhs.first, rhs.first);
+				});
+
+				auto uniqueEnd = std::unique(pairs.begin(), pairs.end(), [&comp](const std::pair<K, V>& lhs, const std::pair<K, V>& rhs) {
+					return !comp(lhs.first, rhs.first);
+				});
+
+				this->BulkLoad(std::make_move_iterator(pairs.begin()), (size_t)(uniqueEnd - pairs.begin()));
+			}
+
+			BTreeMap(std::initializer_list<std::pair<K, V>> list, const Compare& comp = Compare{})
+				: BTreeMap(list.begin(), list.end(), comp) { }
+
+			// Bulk loads a range of pairs already sorted by key and free of duplicates, without checking it
+			template<typename ForwardItr>
+			BTreeMap(SortedUniqueTag, ForwardItr first, ForwardItr last, const Compare& comp = Compare{})
+				: Base(comp) {
+				this->BulkLoad(first, (size_t)std::distance(first, last));
+			}
+
+			// Returns a reference to the value mapped to key. If there is none, throws an exception
+			V& at(const K& key) {
+				Iterator itr = this->find(key);
+
+				if (itr == this->end())
+					throw std::out_of_range("Key not found");
+
+				return itr.value();
+			}
+
+			const V& at(const K& key) const {
+				ConstIterator itr = this->find(key);
+
+				if (itr == this->end())
+					throw std::out_of_range("Key not found");
+
+				return itr.value();
+			}
+
+			// Returns a reference to the value mapped to key, default constructing it if there is none
+			V& operator [](const K& key) {
+				return try_emplace(key).first.value();
+			}
+
+			V& operator [](K&& key) {
+				return try_emplace(std::move(key)).first.value();
+			}
+
+			// Inserts a copy of value if its key isn't present yet. Returns an iterator to the element with that key
+			// and whether the insertion took place
+			std::pair<Iterator, bool> insert(const std::pair<K, V>& value) {
+				return this->Emplace(value.first, value.second);
+			}
+
+			std::pair<Iterator, bool> insert(std::pair<K, V>&& value) {
+				return this->Emplace(std::move(value.first), std::move(value.second));
+			}
+
+			// Constructs the value in place from args if key isn't present yet, does nothing otherwise
+			template<typename Key, typename... Args>
+			std::pair<Iterator, bool> try_emplace(Key&& key, Args&&... args) {
+				return this->Emplace(std::forward<Key>(key), std::forward<Args>(args)...);
+			}
+
+			// Builds the key and value from args, then inserts them if the key isn't present yet
+			template<typename... Args>
+			std::pair<Iterator, bool> emplace(Args&&... args) {
+				std::pair<K, V> value(std::forward<Args>(args)...);
+
+				return this->Emplace(std::move(value.first), std::move(value.second));
+			}
+
+			// Assigns value to key, inserting it if there is none
+			template<typename Key, typename Value>
+			std::pair<Iterator, bool> insert_or_assign(Key&& key, Value&& value) {
+				std::pair<Iterator, bool> result = this->Emplace(std::forward<Key>(key), std::forward<Value>(value));
+
+				if (!result.second)
+					result.first.value() = std::forward<Value>(value);
+
+				return result;
+			}
+	};
+
+	// Ordered set stored as a B+tree of wide nodes, look for: BTreeMap
+	template<typename K, typename Compare = std::less<K>, typename Alloc = Allocator<K>>
+	class BTreeSet : public detail::BTree<K, void, Compare, Alloc> {
+		private:
+			using Base = detail::BTree<K, void, Compare, Alloc>;
+
+		public:
+			using typename Base::KeyType;
+			using typename Base::ValueType;
+			using typename Base::Iterator;
+			using typename Base::ConstIterator;
+
+		public:
+			BTreeSet() = default;
+
+			explicit BTreeSet(const Compare& comp)
+				: Base(comp) { }
+
+			// Builds the set from an unsorted range, sorting and deduplicating it once
+			template<typename InputItr>
+			BTreeSet(InputItr first, InputItr last, const Compare& comp = Compare{})
+				: Base(comp) {
+				Vector<K> keys;
+
+				for (; first != last; ++first)
+					keys.push_back(*first);
+
+				std::sort(keys.begin(), keys.end(), comp);
+
+				auto uniqueEnd = std::unique(keys.begin(), keys.end(), [&comp](const K& lhs, const K& rhs) {
+					return !comp(lhs, rhs);
+				});
+
+				this->BulkLoad(std::make_move_iterator(keys.begin()), (size_t)(uniqueEnd - keys.begin()));
+			}
+
+			BTreeSet(std::initializer_list<K> list, const Compare& comp = Compare{})
+				: BTreeSet(list.begin(), list.end(), comp) { }
+
+			// Bulk loads a range of keys already sorted and free of duplicates, without checking it
+			template<typename ForwardItr>
+			BTreeSet(SortedUniqueTag, ForwardItr first, ForwardItr last, const Compare& comp = Compare{})
+				: Base(comp) {
+				this->BulkLoad(first, (size_t)std::distance(first, last));
+			}
+
+			// Inserts key if it isn't present yet. Returns an iterator to it and whether the insertion took place
+			template<typename Key>
+			std::pair<Iterator, bool> insert(Key&& key) {
+				return this->Emplace(std::forward<Key>(key));
+			}
+
+			// Builds the key from args, then inserts it if it isn't present yet
+			template<typename... Args>
+			std::pair<Iterator, bool> emplace(Args&&... args) {
+				return this->Emplace(K(std::forward<Args>(args)...));
+			}
+	};
+}
\ No newline at end of file
@@ -0,0 +1,581 @@
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+#include "../Memory/Allocator.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Bytes of elements held by a Deque block
+		constexpr size_t DEQUE_BLOCK_BYTES = 4096;
+	}
+
+	template<typename Deque, bool bConst>
+	class DequeIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename Deque::ValueType, typename Deque::ValueType>;
+
+			using iterator_concept	= std::random_access_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename Deque::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		private:
+			using BlockPtr = typename Deque::ValueType*;
+
+			static constexpr ptrdiff_t BLOCK_SIZE = (ptrdiff_t)Deque::BLOCK_SIZE;
+
+		public:
+			DequeIterator() = default;
+
+			DequeIterator(BlockPtr* ppBlock, size_t uOffset)
+				: m_pCur(*ppBlock + uOffset), m_pFirst(*ppBlock), m_ppBlock(ppBlock) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			DequeIterator(const DequeIterator<Deque, bOtherConst>& other)
+				: m_pCur(other.m_pCur), m_pFirst(other.m_pFirst), m_ppBlock(other.m_ppBlock) { }
+
+			DequeIterator& operator ++() {
+				if (++m_pCur == m_pFirst + BLOCK_SIZE)
+					SetBlock(m_ppBlock + 1, 0);
+
+				return *this;
+			}
+
+			DequeIterator operator ++(int) {
+				DequeIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			DequeIterator& operator --() {
+				if (m_pCur == m_pFirst)
+					SetBlock(m_ppBlock - 1, BLOCK_SIZE);
+
+				--m_pCur;
+
+				return *this;
+			}
+
+			DequeIterator operator --(int) {
+				DequeIterator itr = *this;
+
+				--(*this);
+
+				return itr;
+			}
+
+			ValueType& operator [](difference_type iIndex) const {
+				return *(*this + iIndex);
+			}
+
+			ValueType* operator ->() const {
+				return m_pCur;
+			}
+
+			ValueType& operator *() const {
+				return *m_pCur;
+			}
+
+			difference_type operator -(const DequeIterator& other) const {
+				return (m_ppBlock - other.m_ppBlock) * BLOCK_SIZE + (m_pCur - m_pFirst) - (other.m_pCur - other.m_pFirst);
+			}
+
+			DequeIterator operator +(difference_type iOffset) const {
+				DequeIterator itr = *this;
+
+				return itr += iOffset;
+			}
+
+			DequeIterator operator -(difference_type iOffset) const {
+				DequeIterator itr = *this;
+
+				return itr += -iOffset;
+			}
+
+			DequeIterator& operator +=(difference_type iOffset) {
+				difference_type iIndex = (m_pCur - m_pFirst) + iOffset;
+
+				if (iIndex >= 0 && iIndex < BLOCK_SIZE) {
+					m_pCur += iOffset;
+				}
+				else {
+					difference_type iBlocks = iIndex >= 0 ? iIndex / BLOCK_SIZE : -((-iIndex - 1) / BLOCK_SIZE) - 1;
+
+					SetBlock(m_ppBlock + iBlocks, iIndex - iBlocks * BLOCK_SIZE);
+				}
+
+				return *this;
+			}
+
+			DequeIterator& operator -=(difference_type iOffset) {
+				return *this += -iOffset;
+			}
+
+			bool operator ==(const DequeIterator& other) const {
+				return m_ppBlock == other.m_ppBlock && m_pCur - m_pFirst == other.m_pCur - other.m_pFirst;
+			}
+
+			bool operator !=(const DequeIterator& other) const {
+				return !(*this == other);
+			}
+
+			bool operator <(const DequeIterator& other) const {
+				return *this - other < 0;
+			}
+
+			bool operator <=(const DequeIterator& other) const {
+				return *this - other <= 0;
+			}
+
+			bool operator >(const DequeIterator& other) const {
+				return *this - other > 0;
+			}
+
+			bool operator >=(const DequeIterator& other) const {
+				return *this - other >= 0;
+			}
+
+			friend DequeIterator operator +(difference_type iOffset, const DequeIterator& itr) {
+				return itr + iOffset;
+			}
+
+		private:
+			template<typename, bool>
+			friend class DequeIterator;
+
+			// Blocks past the ends may not be allocated, an iterator may still point to their start as an end position
+			void SetBlock(BlockPtr* ppBlock, difference_type iOffset) {
+				m_ppBlock = ppBlock;
+				m_pFirst  = *ppBlock;
+				m_pCur	  = m_pFirst + iOffset;
+			}
+
+		private:
+			ValueType* m_pCur	 = nullptr;
+			ValueType* m_pFirst	 = nullptr;
+			BlockPtr*  m_ppBlock = nullptr;
+	};
+
+	// Double-ended queue made of fixed-size blocks listed in a block map. Pushing at either end only ever constructs
+	// one element, sometimes takes a block and rarely grows the map of block pointers, so elements are never moved or
+	// copied and references to them stay valid until they are popped. Blocks emptied by popping are kept for reuse,
+	// so a deque used as a queue stops allocating once it reaches its working size; shrink_to_fit releases them
+	template<typename T, typename Alloc = Allocator<T>>
+	class Deque {
+		public:
+			using ValueType		= T;
+			using Iterator		= DequeIterator<Deque, false>;
+			using ConstIterator = DequeIterator<Deque, true>;
+
+			// Elements per block, a power of two so positions split into block and offset with a shift and a mask
+			static constexpr size_t BLOCK_SIZE = std::bit_floor(std::max<size_t>(detail::DEQUE_BLOCK_BYTES / sizeof(T), 16));
+
+		private:
+			using MapAllocator = typename Alloc::template rebind<T*>::other;
+
+			static constexpr size_t BLOCK_SHIFT	   = (size_t)std::countr_zero(BLOCK_SIZE);
+			static constexpr size_t MIN_MAP_BLOCKS = 8;
+
+		public:
+			Deque() = default;
+
+			// Constructs uCount copies of value
+			Deque(size_t uCount, const T& value) {
+				for (size_t i = 0; i < uCount; ++i)
+					push_back(value);
+			}
+
+			template<typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category>
+			Deque(InputItr first, InputItr last) {
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+
+			Deque(std::initializer_list<T> list)
+				: Deque(list.begin(), list.end()) { }
+
+			Deque(const Deque& other)
+				: Deque(other.begin(), other.end()) { }
+
+			Deque(Deque&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			~Deque() {
+				Free();
+			}
+
+			// Clears the current deque, copies every element of the other one
+			Deque& operator =(const Deque& other) {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				for (const T& value : other)
+					push_back(value);
+
+				return *this;
+			}
+
+			// Frees the current deque, steals the blocks of the other one and leaves it empty
+			Deque& operator =(Deque&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				Free();
+
+				m_ppMap		  = other.m_ppMap;
+				m_uMapSize	  = other.m_uMapSize;
+				m_uHead		  = other.m_uHead;
+				m_uSize		  = other.m_uSize;
+				m_pSpare	  = other.m_pSpare;
+				m_uSpareCount = other.m_uSpareCount;
+
+				other.m_ppMap		= nullptr;
+				other.m_uMapSize	= 0;
+				other.m_uHead		= 0;
+				other.m_uSize		= 0;
+				other.m_pSpare		= nullptr;
+				other.m_uSpareCount = 0;
+
+				return *this;
+			}
+
+			// Accesses the element at uIndex and returns a reference. If uIndex is invalid, throws an exception
+			T& at(size_t uIndex) {
+				if (uIndex >= m_uSize)
+					throw std::out_of_range("Invalid index");
+
+				return (*this)[uIndex];
+			}
+
+			const T& at(size_t uIndex) const {
+				if (uIndex >= m_uSize)
+					throw std::out_of_range("Invalid index");
+
+				return (*this)[uIndex];
+			}
+
+			// Accesses the element at uIndex and returns a reference
+			T& operator [](size_t uIndex) {
+				size_t uPos = m_uHead + uIndex;
+
+				return m_ppMap[uPos >> BLOCK_SHIFT][uPos & (BLOCK_SIZE - 1)];
+			}
+
+			const T& operator [](size_t uIndex) const {
+				size_t uPos = m_uHead + uIndex;
+
+				return m_ppMap[uPos >> BLOCK_SHIFT][uPos & (BLOCK_SIZE - 1)];
+			}
+
+			// Returns a reference to the first element. If there are no elements, throws an exception
+			T& front() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return (*this)[0];
+			}
+
+			const T& front() const {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return (*this)[0];
+			}
+
+			// Returns a reference to the last element. If there are no elements, throws an exception
+			T& back() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return (*this)[m_uSize - 1];
+			}
+
+			const T& back() const {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return (*this)[m_uSize - 1];
+			}
+
+			void push_back(const T& value) {
+				emplace_back(value);
+			}
+
+			void push_back(T&& value) {
+				emplace_back(std::move(value));
+			}
+
+			// Constructs a T instance with given arguments after the last element
+			template<typename... Args>
+			T& emplace_back(Args&&... args) {
+				size_t uPos	  = m_uHead + m_uSize;
+				size_t uBlock = uPos >> BLOCK_SHIFT;
+
+				// The slot after the last block has to exist, end() may point to it
+				if (uBlock + 1 >= m_uMapSize) {
+					GrowMap();
+
+					uPos   = m_uHead + m_uSize;
+					uBlock = uPos >> BLOCK_SHIFT;
+				}
+
+				if (!m_ppMap[uBlock])
+					m_ppMap[uBlock] = TakeBlock();
+
+				T* pSlot = m_ppMap[uBlock] + (uPos & (BLOCK_SIZE - 1));
+
+				m_Allocator.construct(pSlot, std::forward<Args>(args)...);
+				m_uSize++;
+
+				return *pSlot;
+			}
+
+			void push_front(const T& value) {
+				emplace_front(value);
+			}
+
+			void push_front(T&& value) {
+				emplace_front(std::move(value));
+			}
+
+			// Constructs a T instance with given arguments before the first element
+			template<typename... Args>
+			T& emplace_front(Args&&... args) {
+				if (m_uHead == 0)
+					GrowMap();
+
+				size_t uPos	  = m_uHead - 1;
+				size_t uBlock = uPos >> BLOCK_SHIFT;
+
+				if (!m_ppMap[uBlock])
+					m_ppMap[uBlock] = TakeBlock();
+
+				T* pSlot = m_ppMap[uBlock] + (uPos & (BLOCK_SIZE - 1));
+
+				m_Allocator.construct(pSlot, std::forward<Args>(args)...);
+				m_uHead = uPos;
+				m_uSize++;
+
+				return *pSlot;
+			}
+
+			// If there are any elements, destroys the last one, recycling its block if it was the block's only element
+			void pop_back() {
+				if (m_uSize == 0)
+					return;
+
+				size_t uPos = m_uHead + --m_uSize;
+
+				m_Allocator.destroy(m_ppMap[uPos >> BLOCK_SHIFT] + (uPos & (BLOCK_SIZE - 1)));
+
+				if ((uPos & (BLOCK_SIZE - 1)) == 0)
+					ReleaseBlock(uPos >> BLOCK_SHIFT);
+			}
+
+			// If there are any elements, destroys the first one, recycling its block if it was the block's only element
+			void pop_front() {
+				if (m_uSize == 0)
+					return;
+
+				size_t uPos = m_uHead++;
+
+				m_uSize--;
+				m_Allocator.destroy(m_ppMap[uPos >> BLOCK_SHIFT] + (uPos & (BLOCK_SIZE - 1)));
+
+				if ((m_uHead & (BLOCK_SIZE - 1)) == 0)
+					ReleaseBlock(uPos >> BLOCK_SHIFT);
+			}
+
+			// Destroys every element, keeping their blocks for reuse
+			void clear() {
+				while (m_uSize)
+					pop_back();
+			}
+
+			// Frees the recycled blocks, and the block map as well if there are no elements
+			void shrink_to_fit() {
+				if (m_uSize == 0 && m_ppMap)
+					ReleaseBlock(m_uHead >> BLOCK_SHIFT);
+
+				while (m_pSpare) {
+					SpareBlock* pNext = m_pSpare->pNext;
+
+					m_Allocator.deallocate(reinterpret_cast<T*>(m_pSpare), BLOCK_SIZE);
+					m_pSpare = pNext;
+				}
+
+				m_uSpareCount = 0;
+
+				if (m_uSize == 0)
+					FreeBlocks();
+			}
+
+			void swap(Deque& other) noexcept {
+				std::swap(m_ppMap,		 other.m_ppMap);
+				std::swap(m_uMapSize,	 other.m_uMapSize);
+				std::swap(m_uHead,		 other.m_uHead);
+				std::swap(m_uSize,		 other.m_uSize);
+				std::swap(m_pSpare,		 other.m_pSpare);
+				std::swap(m_uSpareCount, other.m_uSpareCount);
+			}
+
+			bool empty() const {
+				return m_uSize == 0;
+			}
+
+			size_t size() const {
+				return m_uSize;
+			}
+
+			// Returns the number of emptied blocks kept for reuse
+			size_t spare_blocks() const {
+				return m_uSpareCount;
+			}
+
+			Iterator begin() {
+				return MakeIterator(m_uHead);
+			}
+
+			Iterator end() {
+				return MakeIterator(m_uHead + m_uSize);
+			}
+
+			ConstIterator begin() const {
+				return const_cast<Deque*>(this)->MakeIterator(m_uHead);
+			}
+
+			ConstIterator end() const {
+				return const_cast<Deque*>(this)->MakeIterator(m_uHead + m_uSize);
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			// Emptied blocks are chained through their own storage
+			struct SpareBlock {
+				SpareBlock* pNext;
+			};
+
+			static_assert(BLOCK_SIZE * sizeof(T) >= sizeof(SpareBlock), "Blocks have to fit a spare block link");
+
+			Iterator MakeIterator(size_t uPos) {
+				if (!m_ppMap)
+					return Iterator();
+
+				return Iterator(m_ppMap + (uPos >> BLOCK_SHIFT), uPos & (BLOCK_SIZE - 1));
+			}
+
+			T* TakeBlock() {
+				if (!m_pSpare)
+					return m_Allocator.allocate(BLOCK_SIZE);
+
+				T* pBlock = reinterpret_cast<T*>(m_pSpare);
+
+				m_pSpare = m_pSpare->pNext;
+				m_uSpareCount--;
+
+				return pBlock;
+			}
+
+			void ReleaseBlock(size_t uBlock) {
+				if (!m_ppMap[uBlock])
+					return;
+
+				m_pSpare = new(m_ppMap[uBlock]) SpareBlock{ m_pSpare };
+				m_uSpareCount++;
+				m_ppMap[uBlock] = nullptr;
+			}
+
+			// Makes room for a block on both sides of the used ones. Only block pointers move: if the map is at most
+			// half used they're recentred in place, otherwise the map doubles. The elements themselves never move
+			void GrowMap() {
+				size_t uFirst = m_uHead >> BLOCK_SHIFT;
+				size_t uLast  = m_uSize ? (m_uHead + m_uSize - 1) >> BLOCK_SHIFT : uFirst;
+				size_t uUsed  = uLast - uFirst + 1;
+
+				if (m_ppMap && uUsed * 2 + 2 <= m_uMapSize) {
+					size_t uNewFirst = (m_uMapSize - uUsed) / 2;
+
+					std::memmove(m_ppMap + uNewFirst, m_ppMap + uFirst, uUsed * sizeof(T*));
+
+					// Only the slots the blocks left and didn't move into need clearing
+					for (size_t i = uFirst; i < uFirst + uUsed; ++i)
+						if (i < uNewFirst || i >= uNewFirst + uUsed)
+							m_ppMap[i] = nullptr;
+
+					m_uHead = uNewFirst * BLOCK_SIZE + (m_uHead & (BLOCK_SIZE - 1));
+
+					return;
+				}
+
+				size_t uNewSize	 = std::max(m_uMapSize * 2, MIN_MAP_BLOCKS);
+				size_t uNewFirst = (uNewSize - uUsed) / 2;
+				T**	   ppNewMap	 = m_MapAllocator.allocate(uNewSize);
+
+				std::fill(ppNewMap, ppNewMap + uNewSize, nullptr);
+
+				if (m_ppMap) {
+					std::copy(m_ppMap + uFirst, m_ppMap + uFirst + uUsed, ppNewMap + uNewFirst);
+					m_MapAllocator.deallocate(m_ppMap, m_uMapSize);
+				}
+
+				m_ppMap	   = ppNewMap;
+				m_uMapSize = uNewSize;
+				m_uHead	   = uNewFirst * BLOCK_SIZE + (m_uHead & (BLOCK_SIZE - 1));
+			}
+
+			// Deallocates every block and the map, the elements have to be destroyed already
+			void FreeBlocks() {
+				if (!m_ppMap)
+					return;
+
+				for (size_t i = 0; i < m_uMapSize; ++i)
+					if (m_ppMap[i])
+						m_Allocator.deallocate(m_ppMap[i], BLOCK_SIZE);
+
+				m_MapAllocator.deallocate(m_ppMap, m_uMapSize);
+
+				m_ppMap	   = nullptr;
+				m_uMapSize = 0;
+				m_uHead	   = 0;
+			}
+
+			void Free() {
+				clear();
+				shrink_to_fit();
+			}
+
+		private:
+			T**			 m_ppMap	   = nullptr;
+			size_t		 m_uMapSize	   = 0;
+			size_t		 m_uHead	   = 0;
+			size_t		 m_uSize	   = 0;
+			SpareBlock*	 m_pSpare	   = nullptr;
+			size_t		 m_uSpareCount = 0;
+			Alloc		 m_Allocator;
+			MapAllocator m_MapAllocator;
+	};
+}
\ No newline at end of file
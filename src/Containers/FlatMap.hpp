@@ -0,0 +1,888 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#include "Vector.hpp"
+#include "../Algorithms/Search.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Enables the heterogeneous overloads when Compare is transparent, unless Key is really an iterator
+		template<typename Compare, typename Key, typename Itr>
+		using EnableTransparentCompare = std::enable_if_t<std::is_void_v<std::void_t<typename Compare::is_transparent>>
+													   && !std::is_convertible_v<const Key&, Itr>, int>;
+
+		// Constructs an element at the end of vec and rotates it into uIndex
+		template<typename T, typename Alloc, typename... Args>
+		void InsertAt(Vector<T, Alloc>& vec, size_t uIndex, Args&&... args) {
+			vec.emplace_back(std::forward<Args>(args)...);
+			std::rotate(vec.begin() + uIndex, vec.end() - 1, vec.end());
+		}
+
+		// Shifts the elements past uIndex one slot back and destroys the last one
+		template<typename T, typename Alloc>
+		void EraseAt(Vector<T, Alloc>& vec, size_t uIndex) {
+			std::move(vec.begin() + uIndex + 1, vec.end(), vec.begin() + uIndex);
+			vec.pop_back();
+		}
+	}
+
+	template<typename Map, bool bConst>
+	class FlatMapIterator {
+		public:
+			using KeyType	= typename Map::KeyType;
+			using ValueType = std::conditional_t<bConst, const typename Map::MappedType, typename Map::MappedType>;
+			using Reference = std::pair<const KeyType&, ValueType&>;
+
+			// operator -> can't return the address of a temporary pair, so it returns this wrapper instead
+			class ArrowProxy {
+				public:
+					ArrowProxy(Reference ref)
+						: m_Ref(ref) { }
+
+					Reference* operator ->() {
+						return &m_Ref;
+					}
+
+				private:
+					Reference m_Ref;
+			};
+
+			using iterator_concept	= std::random_access_iterator_tag;
+			using iterator_category = std::input_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename Map::ValueType;
+			using pointer			= ArrowProxy;
+			using reference			= Reference;
+
+		public:
+			FlatMapIterator() = default;
+
+			FlatMapIterator(const KeyType* pKey, ValueType* pValue)
+				: m_pKey(pKey), m_pValue(pValue) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			FlatMapIterator(const FlatMapIterator<Map, bOtherConst>& other)
+				: m_pKey(other.m_pKey), m_pValue(other.m_pValue) { }
+
+			FlatMapIterator& operator ++() {
+				++m_pKey;
+				++m_pValue;
+
+				return *this;
+			}
+
+			FlatMapIterator operator ++(int) {
+				FlatMapIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			FlatMapIterator& operator --() {
+				--m_pKey;
+				--m_pValue;
+
+				return *this;
+			}
+
+			FlatMapIterator operator --(int) {
+				FlatMapIterator itr = *this;
+
+				--(*this);
+
+				return itr;
+			}
+
+			Reference operator [](difference_type iIndex) const {
+				return Reference(m_pKey[iIndex], m_pValue[iIndex]);
+			}
+
+			ArrowProxy operator ->() const {
+				return ArrowProxy(**this);
+			}
+
+			Reference operator *() const {
+				return Reference(*m_pKey, *m_pValue);
+			}
+
+			// Returns the key the iterator points to, without building a pair
+			const KeyType& key() const {
+				return *m_pKey;
+			}
+
+			// Returns the value the iterator points to, without building a pair
+			ValueType& value() const {
+				return *m_pValue;
+			}
+
+			difference_type operator -(const FlatMapIterator& other) const {
+				return m_pKey - other.m_pKey;
+			}
+
+			FlatMapIterator operator +(difference_type iOffset) const {
+				return FlatMapIterator(m_pKey + iOffset, m_pValue + iOffset);
+			}
+
+			FlatMapIterator operator -(difference_type iOffset) const {
+				return FlatMapIterator(m_pKey - iOffset, m_pValue - iOffset);
+			}
+
+			FlatMapIterator& operator +=(difference_type iOffset) {
+				m_pKey	 += iOffset;
+				m_pValue += iOffset;
+
+				return *this;
+			}
+
+			FlatMapIterator& operator -=(difference_type iOffset) {
+				m_pKey	 -= iOffset;
+				m_pValue -= iOffset;
+
+				return *this;
+			}
+
+			bool operator ==(const FlatMapIterator& other) const {
+				return m_pKey == other.m_pKey;
+			}
+
+			bool operator !=(const FlatMapIterator& other) const {
+				return m_pKey != other.m_pKey;
+			}
+
+			bool operator <(const FlatMapIterator& other) const {
+				return m_pKey < other.m_pKey;
+			}
+
+			bool operator <=(const FlatMapIterator& other) const {
+				return m_pKey <= other.m_pKey;
+			}
+
+			bool operator >(const FlatMapIterator& other) const {
+				return m_pKey > other.m_pKey;
+			}
+
+			bool operator >=(const FlatMapIterator& other) const {
+				return m_pKey >= other.m_pKey;
+			}
+
+			friend FlatMapIterator operator +(difference_type iOffset, const FlatMapIterator& itr) {
+				return itr + iOffset;
+			}
+
+		private:
+			template<typename, bool>
+			friend class FlatMapIterator;
+
+			const KeyType* m_pKey	= nullptr;
+			ValueType*	   m_pValue = nullptr;
+	};
+
+	// Sorted associative container over two contiguous Vectors, one of keys and one of values at the same indices.
+	// Lookups binary search the keys alone, so the values never pollute the cache while searching, and iteration is
+	// a linear scan. Inserting or erasing a single element shifts everything after it, so build maps in bulk:
+	// the range constructor and insert(first, last) sort once, insert_sorted_range merges in linear time.
+	// Inserting or erasing invalidates iterators and references
+	template<typename K, typename V, typename Compare = std::less<K>, typename KeyAlloc = Allocator<K>, typename ValueAlloc = Allocator<V>>
+	class FlatMap {
+		public:
+			using KeyType		 = K;
+			using MappedType	 = V;
+			using ValueType		 = std::pair<K, V>;
+			using KeyContainer	 = Vector<K, KeyAlloc>;
+			using ValueContainer = Vector<V, ValueAlloc>;
+			using Iterator		 = FlatMapIterator<FlatMap, false>;
+			using ConstIterator	 = FlatMapIterator<FlatMap, true>;
+
+		public:
+			FlatMap() = default;
+
+			explicit FlatMap(const Compare& comp)
+				: m_Compare(comp) { }
+
+			// Builds the map from an unsorted range of pairs. The first of several equal keys wins
+			template<typename InputItr>
+			FlatMap(InputItr first, InputItr last, const Compare& comp = Compare{})
+				: m_Compare(comp) {
+				insert(first, last);
+			}
+
+			FlatMap(std::initializer_list<ValueType> list, const Compare& comp = Compare{})
+				: m_Compare(comp) {
+				insert(list.begin(), list.end());
+			}
+
+			// Adopts key and value vectors that are already sorted and unique, without checking or copying them
+			FlatMap(SortedUniqueTag, KeyContainer&& keys, ValueContainer&& values, const Compare& comp = Compare{})
+				: m_Keys(std::move(keys)), m_Values(std::move(values)), m_Compare(comp) {
+				if (m_Keys.size() != m_Values.size())
+					throw std::out_of_range("Key and value counts differ");
+			}
+
+			// Returns a reference to the value mapped to key. If there is none, throws an exception
+			V& at(const K& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == m_Keys.size())
+					throw std::out_of_range("Key not found");
+
+				return m_Values[uIndex];
+			}
+
+			const V& at(const K& key) const {
+				size_t uIndex = Find(key);
+
+				if (uIndex == m_Keys.size())
+					throw std::out_of_range("Key not found");
+
+				return m_Values[uIndex];
+			}
+
+			// Returns a reference to the value mapped to key, default constructing it if there is none
+			V& operator [](const K& key) {
+				return try_emplace(key).first.value();
+			}
+
+			V& operator [](K&& key) {
+				return try_emplace(std::move(key)).first.value();
+			}
+
+			// Returns an iterator to the element with the given key, or end() if there is none
+			Iterator find(const K& key) {
+				return MakeIterator(Find(key));
+			}
+
+			ConstIterator find(const K& key) const {
+				return MakeIterator(Find(key));
+			}
+
+			// Heterogeneous lookup, available when Compare defines is_transparent
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			Iterator find(const Key& key) {
+				return MakeIterator(Find(key));
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			ConstIterator find(const Key& key) const {
+				return MakeIterator(Find(key));
+			}
+
+			// Returns true if an element with the given key exists, false otherwise
+			bool contains(const K& key) const {
+				return Find(key) != m_Keys.size();
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			bool contains(const Key& key) const {
+				return Find(key) != m_Keys.size();
+			}
+
+			// Returns an iterator to the first element whose key isn't ordered before key
+			Iterator lower_bound(const K& key) {
+				return MakeIterator(LowerBound(key));
+			}
+
+			ConstIterator lower_bound(const K& key) const {
+				return MakeIterator(LowerBound(key));
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			ConstIterator lower_bound(const Key& key) const {
+				return MakeIterator(LowerBound(key));
+			}
+
+			// Returns an iterator to the first element whose key is ordered after key
+			Iterator upper_bound(const K& key) {
+				return MakeIterator(UpperBound(key));
+			}
+
+			ConstIterator upper_bound(const K& key) const {
+				return MakeIterator(UpperBound(key));
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			ConstIterator upper_bound(const Key& key) const {
+				return MakeIterator(UpperBound(key));
+			}
+
+			// Inserts a copy of value if its key isn't present yet. Returns an iterator to the element with that key
+			// and whether the insertion took place
+			std::pair<Iterator, bool> insert(const ValueType& value) {
+				return try_emplace(value.first, value.second);
+			}
+
+			std::pair<Iterator, bool> insert(ValueType&& value) {
+				return try_emplace(std::move(value.first), std::move(value.second));
+			}
+
+			// Inserts an unsorted range of pairs: sorts and deduplicates a copy of it, then merges it in linear time.
+			// Keys already in the map, and the first of several equal keys in the range, win
+			template<typename InputItr>
+			void insert(InputItr first, InputItr last) {
+				Vector<ValueType> pairs;
+
+				if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputItr>::iterator_category>)
+					pairs.reserve((size_t)std::distance(first, last));
+
+				for (; first != last; ++first)
+					pairs.emplace_back(first->first, first->second);
+
+				std::stable_sort(pairs.begin(), pairs.end(), [this](const ValueType& lhs, const ValueType& rhs) {
+					return m_Compare(lhs.first, rhs.first);
+				});
+
+				insert_sorted_range(std::make_move_iterator(pairs.begin()), std::make_move_iterator(pairs.end()));
+			}
+
+			void insert(std::initializer_list<ValueType> list) {
+				insert(list.begin(), list.end());
+			}
+
+			// Merges a range of pairs already sorted by key into the map in a single linear pass.
+			// Keys already in the map, and the first of several equal keys in the range, win
+			template<typename InputItr>
+			void insert_sorted_range(InputItr first, InputItr last) {
+				KeyContainer   keys;
+				ValueContainer values;
+				size_t		   uCount = m_Keys.size();
+				size_t		   i	  = 0;
+
+				if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputItr>::iterator_category>)
+					uCount += (size_t)std::distance(first, last);
+
+				keys.reserve(uCount);
+				values.reserve(uCount);
+
+				for (; first != last; ++first) {
+					auto&& pair = *first;
+
+					while (i < m_Keys.size() && m_Compare(m_Keys[i], pair.first)) {
+						keys.push_back(std::move(m_Keys[i]));
+						values.push_back(std::move(m_Values[i]));
+						++i;
+					}
+
+					if (i < m_Keys.size() && !m_Compare(pair.first, m_Keys[i]))
+						continue;
+
+					if (!keys.empty() && !m_Compare(keys.back(), pair.first))
+						continue;
+
+					keys.push_back(std::forward<decltype(pair)>(pair).first);
+					values.push_back(std::forward<decltype(pair)>(pair).second);
+				}
+
+				for (; i < m_Keys.size(); ++i) {
+					keys.push_back(std::move(m_Keys[i]));
+					values.push_back(std::move(m_Values[i]));
+				}
+
+				m_Keys	 = std::move(keys);
+				m_Values = std::move(values);
+			}
+
+			// Constructs the value in place from args if key isn't present yet, does nothing otherwise
+			template<typename Key, typename... Args>
+			std::pair<Iterator, bool> try_emplace(Key&& key, Args&&... args) {
+				size_t uIndex = LowerBound(key);
+
+				if (uIndex != m_Keys.size() && !m_Compare(key, m_Keys[uIndex]))
+					return { MakeIterator(uIndex), false };
+
+				detail::InsertAt(m_Keys, uIndex, std::forward<Key>(key));
+
+				try {
+					detail::InsertAt(m_Values, uIndex, std::forward<Args>(args)...);
+				}
+				catch (...) {
+					detail::EraseAt(m_Keys, uIndex);
+
+					throw;
+				}
+
+				return { MakeIterator(uIndex), true };
+			}
+
+			// Builds the key and value from args, then inserts them if the key isn't present yet
+			template<typename... Args>
+			std::pair<Iterator, bool> emplace(Args&&... args) {
+				ValueType value(std::forward<Args>(args)...);
+
+				return try_emplace(std::move(value.first), std::move(value.second));
+			}
+
+			// Assigns value to key, inserting it if there is none
+			template<typename Value>
+			std::pair<Iterator, bool> insert_or_assign(const K& key, Value&& value) {
+				std::pair<Iterator, bool> result = try_emplace(key, std::forward<Value>(value));
+
+				if (!result.second)
+					result.first.value() = std::forward<Value>(value);
+
+				return result;
+			}
+
+			template<typename Value>
+			std::pair<Iterator, bool> insert_or_assign(K&& key, Value&& value) {
+				std::pair<Iterator, bool> result = try_emplace(std::move(key), std::forward<Value>(value));
+
+				if (!result.second)
+					result.first.value() = std::forward<Value>(value);
+
+				return result;
+			}
+
+			// Erases the element with the given key, returns the number of erased elements
+			size_t erase(const K& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == m_Keys.size())
+					return 0;
+
+				EraseAt(uIndex);
+
+				return 1;
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			size_t erase(const Key& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == m_Keys.size())
+					return 0;
+
+				EraseAt(uIndex);
+
+				return 1;
+			}
+
+			// Erases the element pos points to, returns an iterator to the one after it
+			Iterator erase(ConstIterator pos) {
+				size_t uIndex = (size_t)(pos - cbegin());
+
+				EraseAt(uIndex);
+
+				return MakeIterator(uIndex);
+			}
+
+			// Erases every element satisfying pred(const K&, V&) in a single pass, returns the number of erased elements
+			template<typename Pred>
+			size_t erase_if(Pred pred) {
+				size_t uKept = 0;
+
+				for (size_t i = 0; i < m_Keys.size(); ++i) {
+					if (pred(static_cast<const K&>(m_Keys[i]), m_Values[i]))
+						continue;
+
+					if (uKept != i) {
+						m_Keys[uKept]	= std::move(m_Keys[i]);
+						m_Values[uKept] = std::move(m_Values[i]);
+					}
+
+					++uKept;
+				}
+
+				size_t uErased = m_Keys.size() - uKept;
+
+				while (m_Keys.size() > uKept) {
+					m_Keys.pop_back();
+					m_Values.pop_back();
+				}
+
+				return uErased;
+			}
+
+			void clear() {
+				m_Keys.clear();
+				m_Values.clear();
+			}
+
+			void reserve(size_t uCount) {
+				m_Keys.reserve(uCount);
+				m_Values.reserve(uCount);
+			}
+
+			void shrink_to_fit() {
+				m_Keys.shrink_to_fit();
+				m_Values.shrink_to_fit();
+			}
+
+			void swap(FlatMap& other) {
+				m_Keys.swap(other.m_Keys);
+				m_Values.swap(other.m_Values);
+				std::swap(m_Compare, other.m_Compare);
+			}
+
+			bool empty() const {
+				return m_Keys.empty();
+			}
+
+			size_t size() const {
+				return m_Keys.size();
+			}
+
+			size_t capacity() const {
+				return m_Keys.capacity();
+			}
+
+			// Returns the sorted keys
+			const KeyContainer& keys() const {
+				return m_Keys;
+			}
+
+			// Returns the values, in the order of their keys
+			const ValueContainer& values() const {
+				return m_Values;
+			}
+
+			Iterator begin() {
+				return MakeIterator(0);
+			}
+
+			Iterator end() {
+				return MakeIterator(m_Keys.size());
+			}
+
+			ConstIterator begin() const {
+				return MakeIterator(0);
+			}
+
+			ConstIterator end() const {
+				return MakeIterator(m_Keys.size());
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			template<typename Key>
+			size_t LowerBound(const Key& key) const {
+				return branchless_lower_bound(m_Keys.data(), m_Keys.size(), key, m_Compare);
+			}
+
+			template<typename Key>
+			size_t UpperBound(const Key& key) const {
+				return branchless_upper_bound(m_Keys.data(), m_Keys.size(), key, m_Compare);
+			}
+
+			// Returns the index of the element with the given key, or size() if there is none
+			template<typename Key>
+			size_t Find(const Key& key) const {
+				size_t uIndex = LowerBound(key);
+
+				if (uIndex != m_Keys.size() && m_Compare(key, m_Keys[uIndex]))
+					return m_Keys.size();
+
+				return uIndex;
+			}
+
+			void EraseAt(size_t uIndex) {
+				detail::EraseAt(m_Keys, uIndex);
+				detail::EraseAt(m_Values, uIndex);
+			}
+
+			Iterator MakeIterator(size_t uIndex) {
+				return Iterator(m_Keys.data() + uIndex, m_Values.data() + uIndex);
+			}
+
+			ConstIterator MakeIterator(size_t uIndex) const {
+				return ConstIterator(m_Keys.data() + uIndex, m_Values.data() + uIndex);
+			}
+
+		private:
+			KeyContainer   m_Keys;
+			ValueContainer m_Values;
+			Compare		   m_Compare;
+	};
+
+	// Sorted set over a single contiguous Vector of keys, searched with a branchless binary search.
+	// Like FlatMap, build it in bulk rather than one key at a time.
+	// Inserting or erasing invalidates iterators and references
+	template<typename K, typename Compare = std::less<K>, typename Alloc = Allocator<K>>
+	class FlatSet {
+		public:
+			using KeyType		= K;
+			using ValueType		= K;
+			using KeyContainer	= Vector<K, Alloc>;
+			using ConstIterator = ConstVectorIterator<KeyContainer>;
+			using Iterator		= ConstIterator;
+
+		public:
+			FlatSet() = default;
+
+			explicit FlatSet(const Compare& comp)
+				: m_Compare(comp) { }
+
+			// Builds the set from an unsorted range, sorting and deduplicating it once
+			template<typename InputItr>
+			FlatSet(InputItr first, InputItr last, const Compare& comp = Compare{})
+				: m_Compare(comp) {
+				insert(first, last);
+			}
+
+			FlatSet(std::initializer_list<K> list, const Compare& comp = Compare{})
+				: m_Compare(comp) {
+				insert(list.begin(), list.end());
+			}
+
+			// Adopts a key vector that is already sorted and unique, without checking or copying it
+			FlatSet(SortedUniqueTag, KeyContainer&& keys, const Compare& comp = Compare{})
+				: m_Keys(std::move(keys)), m_Compare(comp) { }
+
+			// Returns an iterator to the given key, or end() if there is none
+			ConstIterator find(const K& key) const {
+				return begin() + (ptrdiff_t)Find(key);
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			ConstIterator find(const Key& key) const {
+				return begin() + (ptrdiff_t)Find(key);
+			}
+
+			// Returns true if the key is in the set, false otherwise
+			bool contains(const K& key) const {
+				return Find(key) != m_Keys.size();
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			bool contains(const Key& key) const {
+				return Find(key) != m_Keys.size();
+			}
+
+			// Returns an iterator to the first key that isn't ordered before key
+			ConstIterator lower_bound(const K& key) const {
+				return begin() + (ptrdiff_t)LowerBound(key);
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			ConstIterator lower_bound(const Key& key) const {
+				return begin() + (ptrdiff_t)LowerBound(key);
+			}
+
+			// Returns an iterator to the first key that is ordered after key
+			ConstIterator upper_bound(const K& key) const {
+				return begin() + (ptrdiff_t)branchless_upper_bound(m_Keys.data(), m_Keys.size(), key, m_Compare);
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			ConstIterator upper_bound(const Key& key) const {
+				return begin() + (ptrdiff_t)branchless_upper_bound(m_Keys.data(), m_Keys.size(), key, m_Compare);
+			}
+
+			// Inserts key if it isn't present yet. Returns an iterator to it and whether the insertion took place
+			template<typename Key>
+			std::pair<ConstIterator, bool> insert(Key&& key) {
+				size_t uIndex = LowerBound(key);
+
+				if (uIndex != m_Keys.size() && !m_Compare(key, m_Keys[uIndex]))
+					return { begin() + (ptrdiff_t)uIndex, false };
+
+				detail::InsertAt(m_Keys, uIndex, std::forward<Key>(key));
+
+				return { begin() + (ptrdiff_t)uIndex, true };
+			}
+
+			// Builds the key from args, then inserts it if it isn't present yet
+			template<typename... Args>
+			std::pair<ConstIterator, bool> emplace(Args&&... args) {
+				return insert(K(std::forward<Args>(args)...));
+			}
+
+			// Inserts an unsorted range: sorts and deduplicates a copy of it, then merges it in linear time
+			template<typename InputItr>
+			void insert(InputItr first, InputItr last) {
+				KeyContainer keys;
+
+				if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputItr>::iterator_category>)
+					keys.reserve((size_t)std::distance(first, last));
+
+				for (; first != last; ++first)
+					keys.push_back(*first);
+
+				std::sort(keys.begin(), keys.end(), m_Compare);
+
+				insert_sorted_range(std::make_move_iterator(keys.begin()), std::make_move_iterator(keys.end()));
+			}
+
+			void insert(std::initializer_list<K> list) {
+				insert(list.begin(), list.end());
+			}
+
+			// Merges a range of already sorted keys into the set in a single linear pass
+			template<typename InputItr>
+			void insert_sorted_range(InputItr first, InputItr last) {
+				KeyContainer keys;
+				size_t		 uCount = m_Keys.size();
+				size_t		 i		= 0;
+
+				if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputItr>::iterator_category>)
+					uCount += (size_t)std::distance(first, last);
+
+				keys.reserve(uCount);
+
+				for (; first != last; ++first) {
+					auto&& key = *first;
+
+					while (i < m_Keys.size() && m_Compare(m_Keys[i], key))
+						keys.push_back(std::move(m_Keys[i++]));
+
+					if (i < m_Keys.size() && !m_Compare(key, m_Keys[i]))
+						continue;
+
+					if (!keys.empty() && !m_Compare(keys.back(), key))
+						continue;
+
+					keys.push_back(std::forward<decltype(key)>(key));
+				}
+
+				for (; i < m_Keys.size(); ++i)
+					keys.push_back(std::move(m_Keys[i]));
+
+				m_Keys = std::move(keys);
+			}
+
+			// Erases the given key, returns the number of erased keys
+			size_t erase(const K& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == m_Keys.size())
+					return 0;
+
+				detail::EraseAt(m_Keys, uIndex);
+
+				return 1;
+			}
+
+			template<typename Key, typename C = Compare, detail::EnableTransparentCompare<C, Key, ConstIterator> = 0>
+			size_t erase(const Key& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == m_Keys.size())
+					return 0;
+
+				detail::EraseAt(m_Keys, uIndex);
+
+				return 1;
+			}
+
+			// Erases the key pos points to, returns an iterator to the one after it
+			ConstIterator erase(ConstIterator pos) {
+				size_t uIndex = (size_t)(pos - begin());
+
+				detail::EraseAt(m_Keys, uIndex);
+
+				return begin() + (ptrdiff_t)uIndex;
+			}
+
+			// Erases every key satisfying pred in a single pass, returns the number of erased keys
+			template<typename Pred>
+			size_t erase_if(Pred pred) {
+				size_t uKept = 0;
+
+				for (size_t i = 0; i < m_Keys.size(); ++i) {
+					if (pred(static_cast<const K&>(m_Keys[i])))
+						continue;
+
+					if (uKept != i)
+						m_Keys[uKept] = std::move(m_Keys[i]);
+
+					++uKept;
+				}
+
+				size_t uErased = m_Keys.size() - uKept;
+
+				while (m_Keys.size() > uKept)
+					m_Keys.pop_back();
+
+				return uErased;
+			}
+
+			void clear() {
+				m_Keys.clear();
+			}
+
+			void reserve(size_t uCount) {
+				m_Keys.reserve(uCount);
+			}
+
+			void shrink_to_fit() {
+				m_Keys.shrink_to_fit();
+			}
+
+			void swap(FlatSet& other) {
+				m_Keys.swap(other.m_Keys);
+				std::swap(m_Compare, other.m_Compare);
+			}
+
+			bool empty() const {
+				return m_Keys.empty();
+			}
+
+			size_t size() const {
+				return m_Keys.size();
+			}
+
+			size_t capacity() const {
+				return m_Keys.capacity();
+			}
+
+			// Returns the sorted keys
+			const KeyContainer& keys() const {
+				return m_Keys;
+			}
+
+			const K* data() const {
+				return m_Keys.data();
+			}
+
+			ConstIterator begin() const {
+				return m_Keys.begin();
+			}
+
+			ConstIterator end() const {
+				return m_Keys.end();
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			template<typename Key>
+			size_t LowerBound(const Key& key) const {
+				return branchless_lower_bound(m_Keys.data(), m_Keys.size(), key, m_Compare);
+			}
+
+			template<typename Key>
+			size_t Find(const Key& key) const {
+				size_t uIndex = LowerBound(key);
+
+				if (uIndex != m_Keys.size() && m_Compare(key, m_Keys[uIndex]))
+					return m_Keys.size();
+
+				return uIndex;
+			}
+
+		private:
+			KeyContainer m_Keys;
+			Compare		 m_Compare;
+	};
+}
\ No newline at end of file
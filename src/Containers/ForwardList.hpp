@@ -0,0 +1,581 @@
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#include "../Memory/Allocator.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Link part of a ForwardList node, the list head is one of these without a value
+		struct ForwardNodeBase {
+			ForwardNodeBase* pNext = nullptr;
+		};
+
+		template<typename T>
+		struct ForwardNode : ForwardNodeBase {
+			T Value;
+		};
+	}
+
+	template<typename List, bool bConst>
+	class ForwardListIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename List::ValueType, typename List::ValueType>;
+
+			using iterator_concept	= std::forward_iterator_tag;
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename List::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		private:
+			using NodeBase = detail::ForwardNodeBase;
+			using NodeType = typename List::NodeType;
+
+		public:
+			ForwardListIterator() = default;
+
+			explicit ForwardListIterator(NodeBase* pNode)
+				: m_pNode(pNode) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			ForwardListIterator(const ForwardListIterator<List, bOtherConst>& other)
+				: m_pNode(other.m_pNode) { }
+
+			ForwardListIterator& operator ++() {
+				m_pNode = m_pNode->pNext;
+
+				return *this;
+			}
+
+			ForwardListIterator operator ++(int) {
+				ForwardListIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			ValueType* operator ->() const {
+				return &static_cast<NodeType*>(m_pNode)->Value;
+			}
+
+			ValueType& operator *() const {
+				return static_cast<NodeType*>(m_pNode)->Value;
+			}
+
+			bool operator ==(const ForwardListIterator& other) const {
+				return m_pNode == other.m_pNode;
+			}
+
+			bool operator !=(const ForwardListIterator& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			template<typename, bool>
+			friend class ForwardListIterator;
+
+			template<typename, typename>
+			friend class ForwardList;
+
+		private:
+			NodeBase* m_pNode = nullptr;
+	};
+
+	// Singly linked list. A node is the element and one raw pointer, allocated through Alloc, which makes it the
+	// leanest node based container here, especially with a PoolAllocator that stores nodes back to back without
+	// per-allocation headers. Positions are given by the element in front of them, before_begin() stands for the
+	// position in front of the first element.
+	// Splicing and merging relink nodes when both lists have equal allocators, otherwise the elements are moved
+	// into nodes of the receiving list
+	template<typename T, typename Alloc = Allocator<T>>
+	class ForwardList {
+		public:
+			using ValueType		= T;
+			using NodeType		= detail::ForwardNode<T>;
+			using Iterator		= ForwardListIterator<ForwardList, false>;
+			using ConstIterator = ForwardListIterator<ForwardList, true>;
+
+			using value_type	 = T;
+			using size_type		 = size_t;
+			using iterator		 = Iterator;
+			using const_iterator = ConstIterator;
+
+		private:
+			using NodeBase		= detail::ForwardNodeBase;
+			using NodeAllocator = typename Alloc::template rebind<NodeType>::other;
+
+		public:
+			ForwardList() = default;
+
+			// Constructs uCount copies of value
+			ForwardList(size_t uCount, const T& value) {
+				NodeBase* pTail = &m_Head;
+
+				for (size_t i = 0; i < uCount; ++i)
+					pTail = NewNodeAfter(pTail, value);
+			}
+
+			template<typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category>
+			ForwardList(InputItr first, InputItr last) {
+				NodeBase* pTail = &m_Head;
+
+				for (; first != last; ++first)
+					pTail = NewNodeAfter(pTail, *first);
+			}
+
+			ForwardList(std::initializer_list<T> list)
+				: ForwardList(list.begin(), list.end()) { }
+
+			ForwardList(const ForwardList& other)
+				: ForwardList(other.begin(), other.end()) { }
+
+			ForwardList(ForwardList&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			~ForwardList() {
+				clear();
+			}
+
+			// Clears the current list, copies every element of the other one
+			ForwardList& operator =(const ForwardList& other) {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				NodeBase* pTail = &m_Head;
+
+				for (const T& value : other)
+					pTail = NewNodeAfter(pTail, value);
+
+				return *this;
+			}
+
+			// Clears the current list, steals the nodes of the other one together with its allocator and leaves it empty
+			ForwardList& operator =(ForwardList&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				m_Allocator	 = std::move(other.m_Allocator);
+				m_Head.pNext = std::exchange(other.m_Head.pNext, nullptr);
+				m_uSize		 = std::exchange(other.m_uSize, 0);
+
+				return *this;
+			}
+
+			// Returns a reference to the first element. If there are no elements, throws an exception
+			T& front() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return static_cast<NodeType*>(m_Head.pNext)->Value;
+			}
+
+			const T& front() const {
+				return const_cast<ForwardList*>(this)->front();
+			}
+
+			void push_front(const T& value) {
+				emplace_front(value);
+			}
+
+			void push_front(T&& value) {
+				emplace_front(std::move(value));
+			}
+
+			template<typename... Args>
+			T& emplace_front(Args&&... args) {
+				return *emplace_after(cbefore_begin(), std::forward<Args>(args)...);
+			}
+
+			// If there are any elements, destroys the first one
+			void pop_front() {
+				if (m_uSize == 0)
+					return;
+
+				erase_after(cbefore_begin());
+			}
+
+			Iterator insert_after(ConstIterator pos, const T& value) {
+				return emplace_after(pos, value);
+			}
+
+			Iterator insert_after(ConstIterator pos, T&& value) {
+				return emplace_after(pos, std::move(value));
+			}
+
+			// Constructs a T instance with given arguments behind pos and returns an iterator to it
+			template<typename... Args>
+			Iterator emplace_after(ConstIterator pos, Args&&... args) {
+				return Iterator(NewNodeAfter(pos.m_pNode, std::forward<Args>(args)...));
+			}
+
+			// Destroys the element behind pos and returns an iterator to the one after it
+			Iterator erase_after(ConstIterator pos) {
+				NodeBase* pPrev = pos.m_pNode;
+				NodeBase* pNode = pPrev->pNext;
+
+				pPrev->pNext = pNode->pNext;
+				FreeNode(pNode);
+
+				return Iterator(pPrev->pNext);
+			}
+
+			// Destroys the elements in (first; last) and returns last
+			Iterator erase_after(ConstIterator first, ConstIterator last) {
+				NodeBase* pPrev = first.m_pNode;
+
+				while (pPrev->pNext != last.m_pNode) {
+					NodeBase* pNode = pPrev->pNext;
+
+					pPrev->pNext = pNode->pNext;
+					FreeNode(pNode);
+				}
+
+				return Iterator(last.m_pNode);
+			}
+
+			// Moves every element of other behind pos, leaving other empty
+			void splice_after(ConstIterator pos, ForwardList& other) {
+				splice_after(pos, other, other.cbefore_begin(), other.cend());
+			}
+
+			void splice_after(ConstIterator pos, ForwardList&& other) {
+				splice_after(pos, other);
+			}
+
+			// Moves the element behind itr in other to behind pos
+			void splice_after(ConstIterator pos, ForwardList& other, ConstIterator itr) {
+				ConstIterator last = itr;
+
+				++last;
+
+				// Nothing to move, or the element already is behind pos
+				if (last == other.cend() || last == pos)
+					return;
+
+				splice_after(pos, other, itr, ++last);
+			}
+
+			void splice_after(ConstIterator pos, ForwardList&& other, ConstIterator itr) {
+				splice_after(pos, other, itr);
+			}
+
+			// Moves the elements in (first; last) of other to behind pos, which must not be one of them.
+			// Needs a walk over the range to find its end and count it
+			void splice_after(ConstIterator pos, ForwardList& other, ConstIterator first, ConstIterator last) {
+				NodeBase* pFirst = first.m_pNode;
+				NodeBase* pLast	 = last.m_pNode;
+
+				if (pFirst->pNext == pLast || pos.m_pNode == pFirst)
+					return;
+
+				if (!(m_Allocator == other.m_Allocator)) {
+					NodeBase* pTail = pos.m_pNode;
+
+					for (NodeBase* pNode = pFirst->pNext; pNode != pLast; pNode = pNode->pNext)
+						pTail = NewNodeAfter(pTail, std::move(static_cast<NodeType*>(pNode)->Value));
+
+					other.erase_after(first, last);
+
+					return;
+				}
+
+				NodeBase* pBeforeLast = pFirst->pNext;
+				size_t	  uCount	  = 1;
+
+				while (pBeforeLast->pNext != pLast) {
+					pBeforeLast = pBeforeLast->pNext;
+					uCount++;
+				}
+
+				pBeforeLast->pNext = pos.m_pNode->pNext;
+				pos.m_pNode->pNext = pFirst->pNext;
+				pFirst->pNext	   = pLast;
+
+				other.m_uSize -= uCount;
+				m_uSize		  += uCount;
+			}
+
+			void splice_after(ConstIterator pos, ForwardList&& other, ConstIterator first, ConstIterator last) {
+				splice_after(pos, other, first, last);
+			}
+
+			// Merges the sorted other list into this sorted list by relinking nodes, leaving other empty.
+			// Stable, of equal elements the ones of this list come first
+			template<typename Compare = std::less<T>>
+			void merge(ForwardList& other, Compare comp = Compare()) {
+				if (this == &other)
+					return;
+
+				NodeBase* pOther;
+
+				if (m_Allocator == other.m_Allocator) {
+					pOther		 = std::exchange(other.m_Head.pNext, nullptr);
+					m_uSize		+= std::exchange(other.m_uSize, 0);
+				}
+				else {
+					// Moves the elements into nodes of this list first and cuts them off again
+					NodeBase* pLast = BeforeEnd();
+
+					splice_after(ConstIterator(pLast), other);
+
+					pOther		 = pLast->pNext;
+					pLast->pNext = nullptr;
+				}
+
+				m_Head.pNext = MergeChains(m_Head.pNext, pOther, comp);
+			}
+
+			template<typename Compare = std::less<T>>
+			void merge(ForwardList&& other, Compare comp = Compare()) {
+				merge(other, comp);
+			}
+
+			// Stable merge sort that relinks nodes instead of moving elements. Runs of 1, 2, 4... nodes are merged
+			// bottom-up as they are cut off the front, so it needs no recursion and no walk to find halves
+			template<typename Compare = std::less<T>>
+			void sort(Compare comp = Compare()) {
+				// Slot i holds a sorted run of 2^i nodes, enough for any list that fits in memory
+				NodeBase* pRuns[sizeof(size_t) * 8] = {};
+				size_t	  uUsed = 0;
+				NodeBase* pNode = m_Head.pNext;
+
+				while (pNode) {
+					NodeBase* pCarry = pNode;
+					size_t	  i		 = 0;
+
+					pNode		  = pNode->pNext;
+					pCarry->pNext = nullptr;
+
+					// Runs in the slots are older than the carry, so they go first to keep the sort stable
+					for (; pRuns[i]; ++i) {
+						pCarry	 = MergeChains(pRuns[i], pCarry, comp);
+						pRuns[i] = nullptr;
+					}
+
+					pRuns[i] = pCarry;
+
+					if (i >= uUsed)
+						uUsed = i + 1;
+				}
+
+				NodeBase* pSorted = nullptr;
+
+				for (size_t i = 0; i < uUsed; ++i) {
+					if (pRuns[i])
+						pSorted = MergeChains(pRuns[i], pSorted, comp);
+				}
+
+				m_Head.pNext = pSorted;
+			}
+
+			// Reverses the order of the elements by relinking nodes
+			void reverse() {
+				NodeBase* pPrev = nullptr;
+				NodeBase* pNode = m_Head.pNext;
+
+				while (pNode) {
+					NodeBase* pNext = pNode->pNext;
+
+					pNode->pNext = pPrev;
+					pPrev		 = pNode;
+					pNode		 = pNext;
+				}
+
+				m_Head.pNext = pPrev;
+			}
+
+			// Destroys every element satisfying pred and returns how many were removed
+			template<typename Predicate>
+			size_t remove_if(Predicate pred) {
+				size_t	  uRemoved = 0;
+				NodeBase* pPrev	   = &m_Head;
+
+				while (pPrev->pNext) {
+					NodeBase* pNode = pPrev->pNext;
+
+					if (pred(static_cast<NodeType*>(pNode)->Value)) {
+						pPrev->pNext = pNode->pNext;
+						FreeNode(pNode);
+						uRemoved++;
+					}
+					else
+						pPrev = pNode;
+				}
+
+				return uRemoved;
+			}
+
+			size_t remove(const T& value) {
+				// value may be an element of the list, so it is compared against a copy
+				T copy = value;
+
+				return remove_if([&copy](const T& element) { return element == copy; });
+			}
+
+			// Destroys every element equal to the one before it and returns how many were removed
+			template<typename BinaryPredicate = std::equal_to<T>>
+			size_t unique(BinaryPredicate pred = BinaryPredicate()) {
+				size_t	  uRemoved = 0;
+				NodeBase* pPrev	   = m_Head.pNext;
+
+				while (pPrev && pPrev->pNext) {
+					NodeBase* pNode = pPrev->pNext;
+
+					if (pred(static_cast<NodeType*>(pPrev)->Value, static_cast<NodeType*>(pNode)->Value)) {
+						pPrev->pNext = pNode->pNext;
+						FreeNode(pNode);
+						uRemoved++;
+					}
+					else
+						pPrev = pNode;
+				}
+
+				return uRemoved;
+			}
+
+			// Destroys every element and frees every node
+			void clear() {
+				while (m_Head.pNext) {
+					NodeBase* pNext = m_Head.pNext->pNext;
+
+					FreeNode(m_Head.pNext);
+					m_Head.pNext = pNext;
+				}
+			}
+
+			void swap(ForwardList& other) noexcept {
+				std::swap(m_Allocator, other.m_Allocator);
+				std::swap(m_Head.pNext, other.m_Head.pNext);
+				std::swap(m_uSize, other.m_uSize);
+			}
+
+			bool empty() const {
+				return m_uSize == 0;
+			}
+
+			size_t size() const {
+				return m_uSize;
+			}
+
+			Iterator before_begin() {
+				return Iterator(&m_Head);
+			}
+
+			Iterator begin() {
+				return Iterator(m_Head.pNext);
+			}
+
+			Iterator end() {
+				return Iterator(nullptr);
+			}
+
+			ConstIterator before_begin() const {
+				return const_cast<ForwardList*>(this)->before_begin();
+			}
+
+			ConstIterator begin() const {
+				return const_cast<ForwardList*>(this)->begin();
+			}
+
+			ConstIterator end() const {
+				return const_cast<ForwardList*>(this)->end();
+			}
+
+			ConstIterator cbefore_begin() const {
+				return before_begin();
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			// Allocates a node holding T(args...), links it behind pPrev and returns it
+			template<typename... Args>
+			NodeBase* NewNodeAfter(NodeBase* pPrev, Args&&... args) {
+				NodeType* pNode = m_Allocator.allocate(1);
+
+				try {
+					new(&pNode->Value) T(std::forward<Args>(args)...);
+				}
+				catch (...) {
+					m_Allocator.deallocate(pNode, 1);
+
+					throw;
+				}
+
+				pNode->pNext = pPrev->pNext;
+				pPrev->pNext = pNode;
+				m_uSize++;
+
+				return pNode;
+			}
+
+			// Destroys and frees an already unlinked node
+			void FreeNode(NodeBase* pNode) {
+				NodeType* pTyped = static_cast<NodeType*>(pNode);
+
+				pTyped->Value.~T();
+				m_Allocator.deallocate(pTyped, 1);
+				m_uSize--;
+			}
+
+			NodeBase* BeforeEnd() {
+				NodeBase* pNode = &m_Head;
+
+				while (pNode->pNext)
+					pNode = pNode->pNext;
+
+				return pNode;
+			}
+
+			// Merges two sorted null terminated chains, taking from pFirst on ties
+			template<typename Compare>
+			static NodeBase* MergeChains(NodeBase* pFirst, NodeBase* pSecond, Compare& comp) {
+				NodeBase  head;
+				NodeBase* pTail = &head;
+
+				while (pFirst && pSecond) {
+					if (comp(static_cast<NodeType*>(pSecond)->Value, static_cast<NodeType*>(pFirst)->Value)) {
+						pTail->pNext = pSecond;
+						pSecond		 = pSecond->pNext;
+					}
+					else {
+						pTail->pNext = pFirst;
+						pFirst		 = pFirst->pNext;
+					}
+
+					pTail = pTail->pNext;
+				}
+
+				pTail->pNext = pFirst ? pFirst : pSecond;
+
+				return head.pNext;
+			}
+
+		private:
+			NodeBase	  m_Head;
+			size_t		  m_uSize = 0;
+			NodeAllocator m_Allocator;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,674 @@
+#pragma once
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <tuple>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <functional>
+#include <type_traits>
+#include <initializer_list>
+
+#include "../Memory/Memory.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Control byte of a slot: EMPTY, or the 7 low bits of the element's hash when the slot is full
+		constexpr int8_t CTRL_EMPTY = -128;
+
+		// Number of control bytes probed at once
+		constexpr size_t GROUP_WIDTH = 16;
+
+		// GROUP_WIDTH control bytes loaded at once, queried for matching hashes and empty slots.
+		// Results are bitmasks where bit i stands for the i-th slot of the group
+		class ControlGroup {
+			public:
+				explicit ControlGroup(const int8_t* pCtrl) {
+				#ifdef NSTD_HAS_SSE2
+					m_Ctrl = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pCtrl));
+				#else
+					std::memcpy(m_Ctrl, pCtrl, GROUP_WIDTH);
+				#endif
+				}
+
+				uint32_t Match(int8_t h2) const {
+				#ifdef NSTD_HAS_SSE2
+					return (uint32_t)_mm_movemask_epi8(_mm_cmpeq_epi8(m_Ctrl, _mm_set1_epi8(h2)));
+				#else
+					uint32_t uMask = 0;
+
+					for (size_t i = 0; i < GROUP_WIDTH; ++i)
+						uMask |= (uint32_t)(m_Ctrl[i] == h2) << i;
+
+					return uMask;
+				#endif
+				}
+
+				uint32_t MatchEmpty() const {
+					return Match(CTRL_EMPTY);
+				}
+
+			private:
+			#ifdef NSTD_HAS_SSE2
+				__m128i m_Ctrl;
+			#else
+				int8_t m_Ctrl[GROUP_WIDTH];
+			#endif
+		};
+
+		// Spreads the bits of weak hashes (std::hash of integers is the identity) over the whole word
+		inline uint64_t MixHash(uint64_t uHash) {
+			uHash ^= uHash >> 33;
+			uHash *= 0xFF51AFD7ED558CCDull;
+			uHash ^= uHash >> 33;
+
+			return uHash;
+		}
+
+		// Enables the heterogeneous overloads when both Hash and Eq are transparent, unless Key is really an iterator
+		template<typename Hash, typename Eq, typename Key, typename Itr>
+		using EnableTransparent = std::enable_if_t<std::is_void_v<std::void_t<typename Hash::is_transparent, typename Eq::is_transparent>>
+												&& !std::is_convertible_v<const Key&, Itr>, int>;
+	}
+
+	template<typename K, typename V, typename Hash, typename Eq, typename Alloc>
+	class HashMap;
+
+	template<typename Map, bool bConst>
+	class HashMapIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename Map::ValueType, typename Map::ValueType>;
+
+			using iterator_category = std::forward_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename Map::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		public:
+			HashMapIterator() = default;
+
+			HashMapIterator(const int8_t* pCtrl, ValueType* pSlots, size_t uIndex, size_t uCapacity)
+				: m_pCtrl(pCtrl), m_pSlots(pSlots), m_uIndex(uIndex), m_uCapacity(uCapacity) {
+				SkipEmpty();
+			}
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			HashMapIterator(const HashMapIterator<Map, bOtherConst>& other)
+				: m_pCtrl(other.m_pCtrl), m_pSlots(other.m_pSlots), m_uIndex(other.m_uIndex), m_uCapacity(other.m_uCapacity) { }
+
+			HashMapIterator& operator ++() {
+				++m_uIndex;
+				SkipEmpty();
+
+				return *this;
+			}
+
+			HashMapIterator operator ++(int) {
+				HashMapIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			ValueType& operator *() const {
+				return m_pSlots[m_uIndex];
+			}
+
+			ValueType* operator ->() const {
+				return m_pSlots + m_uIndex;
+			}
+
+			bool operator ==(const HashMapIterator& other) const {
+				return m_uIndex == other.m_uIndex && m_pSlots == other.m_pSlots;
+			}
+
+			bool operator !=(const HashMapIterator& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			template<typename, bool>
+			friend class HashMapIterator;
+
+			template<typename, typename, typename, typename, typename>
+			friend class HashMap;
+
+			void SkipEmpty() {
+				while (m_uIndex < m_uCapacity && m_pCtrl[m_uIndex] == detail::CTRL_EMPTY)
+					++m_uIndex;
+			}
+
+		private:
+			const int8_t* m_pCtrl	  = nullptr;
+			ValueType*	  m_pSlots	  = nullptr;
+			size_t		  m_uIndex	  = 0;
+			size_t		  m_uCapacity = 0;
+	};
+
+	// Open-addressing hash map with flat storage (Swiss table layout). Every slot has a control byte holding
+	// 7 bits of its element's hash, which are compared 16 slots at a time (with SSE2 when available), so most
+	// lookups touch a single cache line of control bytes and compare keys only on a likely match.
+	// Probing is linear by groups and erasure shifts the following elements back, so no tombstones are ever left.
+	// Inserting or erasing invalidates iterators and references
+	template<typename K, typename V, typename Hash = std::hash<K>, typename Eq = std::equal_to<K>, typename Alloc = Allocator<std::pair<const K, V>>>
+	class HashMap {
+		public:
+			using KeyType		= K;
+			using MappedType	= V;
+			using ValueType		= std::pair<const K, V>;
+			using Iterator		= HashMapIterator<HashMap, false>;
+			using ConstIterator = HashMapIterator<HashMap, true>;
+
+		private:
+			using CtrlAllocator = typename Alloc::template rebind<int8_t>::other;
+
+			// Fraction of the slots that may be full before the table grows
+			static constexpr size_t MAX_LOAD_NUM = 7;
+			static constexpr size_t MAX_LOAD_DEN = 8;
+
+		public:
+			HashMap() = default;
+
+			// Allocates enough slots to hold uCount elements without rehashing. Stateful hash and equality functions,
+			// e.g. a hash seeded per map, are given here and go along with the elements when the map is copied or moved
+			explicit HashMap(size_t uCount, const Hash& hash = Hash(), const Eq& eq = Eq())
+				: m_Hash(hash), m_Eq(eq) {
+				reserve(uCount);
+			}
+
+			HashMap(std::initializer_list<ValueType> list) {
+				reserve(list.size());
+
+				for (const ValueType& value : list)
+					insert(value);
+			}
+
+			HashMap(const HashMap& other)
+				: m_Hash(other.m_Hash), m_Eq(other.m_Eq) {
+				*this = other;
+			}
+
+			HashMap(HashMap&& other) noexcept
+				: m_Hash(other.m_Hash), m_Eq(other.m_Eq) {
+				*this = std::move(other);
+			}
+
+			~HashMap() {
+				Free();
+			}
+
+			// Clears the current map, copies the hash and equality functions and every element of the other one
+			HashMap& operator =(const HashMap& other) {
+				if (this == &other)
+					return *this;
+
+				clear();
+				m_Hash = other.m_Hash;
+				m_Eq   = other.m_Eq;
+				reserve(other.m_uSize);
+
+				for (const ValueType& value : other)
+					insert(value);
+
+				return *this;
+			}
+
+			// Frees the current map, steals the storage of the other one and leaves it empty. The hash and equality
+			// functions are copied, the elements were placed by them and the other map may still be used
+			HashMap& operator =(HashMap&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				Free();
+
+				m_Hash		= other.m_Hash;
+				m_Eq		= other.m_Eq;
+				m_pCtrl		= other.m_pCtrl;
+				m_pSlots	= other.m_pSlots;
+				m_uSize		= other.m_uSize;
+				m_uCapacity = other.m_uCapacity;
+
+				other.m_pCtrl	  = nullptr;
+				other.m_pSlots	  = nullptr;
+				other.m_uSize	  = 0;
+				other.m_uCapacity = 0;
+
+				return *this;
+			}
+
+			// Returns a reference to the value mapped to key. If there is none, throws an exception
+			V& at(const K& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == NOT_FOUND)
+					throw std::out_of_range("Key not found");
+
+				return m_pSlots[uIndex].second;
+			}
+
+			const V& at(const K& key) const {
+				size_t uIndex = Find(key);
+
+				if (uIndex == NOT_FOUND)
+					throw std::out_of_range("Key not found");
+
+				return m_pSlots[uIndex].second;
+			}
+
+			// Returns a reference to the value mapped to key, default constructing it if there is none
+			V& operator [](const K& key) {
+				return try_emplace(key).first->second;
+			}
+
+			V& operator [](K&& key) {
+				return try_emplace(std::move(key)).first->second;
+			}
+
+			// Returns an iterator to the element with the given key, or end() if there is none
+			Iterator find(const K& key) {
+				return MakeIterator(Find(key));
+			}
+
+			ConstIterator find(const K& key) const {
+				return MakeIterator(Find(key));
+			}
+
+			// Heterogeneous lookup, available when both Hash and Eq define is_transparent
+			template<typename Key, typename H = Hash, typename E = Eq, detail::EnableTransparent<H, E, Key, ConstIterator> = 0>
+			Iterator find(const Key& key) {
+				return MakeIterator(Find(key));
+			}
+
+			template<typename Key, typename H = Hash, typename E = Eq, detail::EnableTransparent<H, E, Key, ConstIterator> = 0>
+			ConstIterator find(const Key& key) const {
+				return MakeIterator(Find(key));
+			}
+
+			// Returns true if an element with the given key exists, false otherwise
+			bool contains(const K& key) const {
+				return Find(key) != NOT_FOUND;
+			}
+
+			template<typename Key, typename H = Hash, typename E = Eq, detail::EnableTransparent<H, E, Key, ConstIterator> = 0>
+			bool contains(const Key& key) const {
+				return Find(key) != NOT_FOUND;
+			}
+
+			// Inserts a copy of value if its key isn't present yet. Returns an iterator to the element with that key
+			// and whether the insertion took place
+			std::pair<Iterator, bool> insert(const ValueType& value) {
+				return try_emplace(value.first, value.second);
+			}
+
+			std::pair<Iterator, bool> insert(ValueType&& value) {
+				return try_emplace(value.first, std::move(value.second));
+			}
+
+			// Constructs the value in place from args if key isn't present yet, does nothing otherwise
+			template<typename Key, typename... Args>
+			std::pair<Iterator, bool> try_emplace(Key&& key, Args&&... args) {
+				uint64_t uHash	= HashOf(key);
+				size_t	 uIndex = Find(key, uHash);
+
+				if (uIndex != NOT_FOUND)
+					return { MakeIterator(uIndex), false };
+
+				uIndex = PrepareInsert(uHash);
+
+				try {
+					m_Allocator.construct(m_pSlots + uIndex, std::piecewise_construct,
+										  std::forward_as_tuple(std::forward<Key>(key)), std::forward_as_tuple(std::forward<Args>(args)...));
+				}
+				catch (...) {
+					SetCtrl(uIndex, detail::CTRL_EMPTY);
+					m_uSize--;
+
+					throw;
+				}
+
+				return { MakeIterator(uIndex), true };
+			}
+
+			// Builds the key and value from args, then inserts them if the key isn't present yet
+			template<typename... Args>
+			std::pair<Iterator, bool> emplace(Args&&... args) {
+				std::pair<K, V> value(std::forward<Args>(args)...);
+
+				return try_emplace(std::move(value.first), std::move(value.second));
+			}
+
+			// Assigns value to key, inserting it if there is none
+			template<typename Value>
+			std::pair<Iterator, bool> insert_or_assign(const K& key, Value&& value) {
+				std::pair<Iterator, bool> result = try_emplace(key, std::forward<Value>(value));
+
+				if (!result.second)
+					result.first->second = std::forward<Value>(value);
+
+				return result;
+			}
+
+			template<typename Value>
+			std::pair<Iterator, bool> insert_or_assign(K&& key, Value&& value) {
+				std::pair<Iterator, bool> result = try_emplace(std::move(key), std::forward<Value>(value));
+
+				if (!result.second)
+					result.first->second = std::forward<Value>(value);
+
+				return result;
+			}
+
+			// Erases the element with the given key, returns the number of erased elements
+			size_t erase(const K& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == NOT_FOUND)
+					return 0;
+
+				EraseAt(uIndex);
+
+				return 1;
+			}
+
+			template<typename Key, typename H = Hash, typename E = Eq, detail::EnableTransparent<H, E, Key, ConstIterator> = 0>
+			size_t erase(const Key& key) {
+				size_t uIndex = Find(key);
+
+				if (uIndex == NOT_FOUND)
+					return 0;
+
+				EraseAt(uIndex);
+
+				return 1;
+			}
+
+			// Erases the element pos points to. Following elements may shift into its slot,
+			// so use erase_if to erase while iterating
+			void erase(ConstIterator pos) {
+				EraseAt(pos.m_uIndex);
+			}
+
+			// Erases every element satisfying pred, returns the number of erased elements
+			template<typename Pred>
+			size_t erase_if(Pred pred) {
+				size_t uErased = 0;
+
+				for (size_t i = 0; i < m_uCapacity; ++i) {
+					// An element shifted back into slot i has to be checked as well
+					while (m_pCtrl[i] != detail::CTRL_EMPTY && pred(m_pSlots[i])) {
+						EraseAt(i);
+						++uErased;
+					}
+				}
+
+				return uErased;
+			}
+
+			// Destroys every element, keeps the allocated slots
+			void clear() {
+				for (size_t i = 0; i < m_uCapacity; ++i) {
+					if (m_pCtrl[i] != detail::CTRL_EMPTY) {
+						m_Allocator.destroy(m_pSlots + i);
+						SetCtrl(i, detail::CTRL_EMPTY);
+					}
+				}
+
+				m_uSize = 0;
+			}
+
+			// Makes room for uCount elements without further rehashing
+			void reserve(size_t uCount) {
+				size_t uCapacity = CapacityFor(uCount);
+
+				if (uCapacity > m_uCapacity)
+					Rehash(uCapacity);
+			}
+
+			// Swaps with the given map, not invoking any copy, move or swap operations on the elements
+			void swap(HashMap& other) noexcept {
+				std::swap(m_Hash,	   other.m_Hash);
+				std::swap(m_Eq,		   other.m_Eq);
+				std::swap(m_pCtrl,	   other.m_pCtrl);
+				std::swap(m_pSlots,	   other.m_pSlots);
+				std::swap(m_uSize,	   other.m_uSize);
+				std::swap(m_uCapacity, other.m_uCapacity);
+			}
+
+			bool empty() const {
+				return m_uSize == 0;
+			}
+
+			size_t size() const {
+				return m_uSize;
+			}
+
+			// Returns the number of slots
+			size_t capacity() const {
+				return m_uCapacity;
+			}
+
+			float load_factor() const {
+				return m_uCapacity ? (float)m_uSize / (float)m_uCapacity : 0.0f;
+			}
+
+			Iterator begin() {
+				return Iterator(m_pCtrl, m_pSlots, 0, m_uCapacity);
+			}
+
+			Iterator end() {
+				return Iterator(m_pCtrl, m_pSlots, m_uCapacity, m_uCapacity);
+			}
+
+			ConstIterator begin() const {
+				return ConstIterator(m_pCtrl, m_pSlots, 0, m_uCapacity);
+			}
+
+			ConstIterator end() const {
+				return ConstIterator(m_pCtrl, m_pSlots, m_uCapacity, m_uCapacity);
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			static constexpr size_t NOT_FOUND = (size_t)-1;
+
+			template<typename Key>
+			uint64_t HashOf(const Key& key) const {
+				return detail::MixHash((uint64_t)m_Hash(key));
+			}
+
+			static int8_t H2(uint64_t uHash) {
+				return (int8_t)(uHash & 0x7F);
+			}
+
+			size_t H1(uint64_t uHash) const {
+				return (size_t)(uHash >> 7) & (m_uCapacity - 1);
+			}
+
+			// Smallest power of two capacity, at least one group wide, that keeps uCount elements under the max load
+			static size_t CapacityFor(size_t uCount) {
+				if (uCount == 0)
+					return 0;
+
+				size_t uCapacity = detail::GROUP_WIDTH;
+
+				while (uCapacity * MAX_LOAD_NUM / MAX_LOAD_DEN < uCount)
+					uCapacity *= 2;
+
+				return uCapacity;
+			}
+
+			// The first GROUP_WIDTH control bytes are mirrored past the end, so groups can be loaded across the wrap-around
+			void SetCtrl(size_t uIndex, int8_t ctrl) {
+				m_pCtrl[uIndex] = ctrl;
+
+				if (uIndex < detail::GROUP_WIDTH)
+					m_pCtrl[m_uCapacity + uIndex] = ctrl;
+			}
+
+			template<typename Key>
+			size_t Find(const Key& key) const {
+				return m_uSize ? Find(key, HashOf(key)) : NOT_FOUND;
+			}
+
+			// Probes group after group from the home slot of the hash, stopping at the first group with an empty slot
+			template<typename Key>
+			size_t Find(const Key& key, uint64_t uHash) const {
+				if (m_uCapacity == 0)
+					return NOT_FOUND;
+
+				size_t uMask = m_uCapacity - 1;
+				size_t uPos	 = H1(uHash);
+				int8_t h2	 = H2(uHash);
+
+				while (true) {
+					detail::ControlGroup group(m_pCtrl + uPos);
+
+					for (uint32_t uMatch = group.Match(h2); uMatch; uMatch &= uMatch - 1) {
+						size_t uIndex = (uPos + std::countr_zero(uMatch)) & uMask;
+
+						if (m_Eq(m_pSlots[uIndex].first, key))
+							return uIndex;
+					}
+
+					if (group.MatchEmpty())
+						return NOT_FOUND;
+
+					uPos = (uPos + detail::GROUP_WIDTH) & uMask;
+				}
+			}
+
+			// Returns the first empty slot on the probe sequence of the hash, growing the table first if needed
+			size_t PrepareInsert(uint64_t uHash) {
+				if (m_uSize + 1 > m_uCapacity * MAX_LOAD_NUM / MAX_LOAD_DEN)
+					Rehash(m_uCapacity ? m_uCapacity * 2 : detail::GROUP_WIDTH);
+
+				size_t uMask = m_uCapacity - 1;
+				size_t uPos	 = H1(uHash);
+
+				while (true) {
+					uint32_t uEmpty = detail::ControlGroup(m_pCtrl + uPos).MatchEmpty();
+
+					if (uEmpty) {
+						size_t uIndex = (uPos + std::countr_zero(uEmpty)) & uMask;
+
+						SetCtrl(uIndex, H2(uHash));
+						m_uSize++;
+
+						return uIndex;
+					}
+
+					uPos = (uPos + detail::GROUP_WIDTH) & uMask;
+				}
+			}
+
+			// Backward shift deletion: every following element up to the next empty slot that may live
+			// closer to its home slot is moved back into the hole, so lookups never need tombstones
+			void EraseAt(size_t uHole) {
+				size_t uMask = m_uCapacity - 1;
+
+				m_Allocator.destroy(m_pSlots + uHole);
+
+				for (size_t j = (uHole + 1) & uMask; m_pCtrl[j] != detail::CTRL_EMPTY; j = (j + 1) & uMask) {
+					size_t uHome = H1(HashOf(m_pSlots[j].first));
+
+					if (((j - uHome) & uMask) < ((j - uHole) & uMask))
+						continue;
+
+					MoveSlot(uHole, j);
+					SetCtrl(uHole, m_pCtrl[j]);
+					uHole = j;
+				}
+
+				SetCtrl(uHole, detail::CTRL_EMPTY);
+				m_uSize--;
+			}
+
+			// Moves the element out of uFrom into the raw slot uTo, then destroys it. The key is
+			// const only towards the user, the source is never used again
+			void MoveSlot(size_t uTo, size_t uFrom) {
+				ValueType& from = m_pSlots[uFrom];
+
+				m_Allocator.construct(m_pSlots + uTo, std::move(const_cast<K&>(from.first)), std::move(from.second));
+				m_Allocator.destroy(m_pSlots + uFrom);
+			}
+
+			void Rehash(size_t uNewCap) {
+				int8_t*	   pOldCtrl	 = m_pCtrl;
+				ValueType* pOldSlots = m_pSlots;
+				size_t	   uOldCap	 = m_uCapacity;
+
+				m_pCtrl		= m_CtrlAllocator.allocate(uNewCap + detail::GROUP_WIDTH);
+				m_pSlots	= m_Allocator.allocate(uNewCap);
+				m_uCapacity = uNewCap;
+				m_uSize		= 0;
+
+				std::memset(m_pCtrl, (unsigned char)detail::CTRL_EMPTY, uNewCap + detail::GROUP_WIDTH);
+
+				for (size_t i = 0; i < uOldCap; ++i) {
+					if (pOldCtrl[i] == detail::CTRL_EMPTY)
+						continue;
+
+					ValueType& old	  = pOldSlots[i];
+					size_t	   uIndex = PrepareInsert(HashOf(old.first));
+
+					m_Allocator.construct(m_pSlots + uIndex, std::move(const_cast<K&>(old.first)), std::move(old.second));
+					m_Allocator.destroy(pOldSlots + i);
+				}
+
+				if (uOldCap) {
+					m_CtrlAllocator.deallocate(pOldCtrl, uOldCap + detail::GROUP_WIDTH);
+					m_Allocator.deallocate(pOldSlots, uOldCap);
+				}
+			}
+
+			void Free() {
+				if (m_uCapacity == 0)
+					return;
+
+				clear();
+				m_CtrlAllocator.deallocate(m_pCtrl, m_uCapacity + detail::GROUP_WIDTH);
+				m_Allocator.deallocate(m_pSlots, m_uCapacity);
+
+				m_pCtrl		= nullptr;
+				m_pSlots	= nullptr;
+				m_uCapacity = 0;
+			}
+
+			Iterator MakeIterator(size_t uIndex) {
+				return uIndex == NOT_FOUND ? end() : Iterator(m_pCtrl, m_pSlots, uIndex, m_uCapacity);
+			}
+
+			ConstIterator MakeIterator(size_t uIndex) const {
+				return uIndex == NOT_FOUND ? end() : ConstIterator(m_pCtrl, m_pSlots, uIndex, m_uCapacity);
+			}
+
+		private:
+			int8_t*		  m_pCtrl	  = nullptr;
+			ValueType*	  m_pSlots	  = nullptr;
+			size_t		  m_uSize	  = 0;
+			size_t		  m_uCapacity = 0;
+			Hash		  m_Hash;
+			Eq			  m_Eq;
+			Alloc		  m_Allocator;
+			CtrlAllocator m_CtrlAllocator;
+	};
+}
+
+namespace std {
+	template<typename K, typename V, typename Hash, typename Eq, typename Alloc>
+	void swap(nstd::HashMap<K, V, Hash, Eq, Alloc>& lhs, nstd::HashMap<K, V, Hash, Eq, Alloc>& rhs) noexcept {
+		lhs.swap(rhs);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,856 @@
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+#include "../Memory/Allocator.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Bytes of elements an IndexedList leaf holds by default
+		constexpr size_t INDEXED_LEAF_BYTES = 256;
+
+		// Children per inner node of an IndexedList
+		constexpr size_t INDEXED_FANOUT = 32;
+
+		struct IndexedInner;
+
+		// Where a node hangs in the tree, uSlot is its index among the children of pParent
+		struct IndexedNodeBase {
+			IndexedInner* pParent = nullptr;
+			size_t		  uSlot	  = 0;
+		};
+
+		// Inner node, uSizes holds the number of elements below each child
+		struct IndexedInner : IndexedNodeBase {
+			size_t			 uCount = 0;
+			size_t			 uSizes[INDEXED_FANOUT];
+			IndexedNodeBase* pChildren[INDEXED_FANOUT];
+		};
+
+		// Leaf holding up to _Capacity elements, the first uCount of them constructed. Leaves are also chained in
+		// order for iteration
+		template<typename T, size_t _Capacity>
+		struct IndexedLeaf : IndexedNodeBase {
+			IndexedLeaf* pPrev	= nullptr;
+			IndexedLeaf* pNext	= nullptr;
+			size_t		 uCount = 0;
+
+			alignas(T) unsigned char Storage[_Capacity * sizeof(T)];
+
+			T* Data() {
+				return std::launder(reinterpret_cast<T*>(Storage));
+			}
+		};
+	}
+
+	template<typename List, bool bConst>
+	class IndexedListIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename List::ValueType, typename List::ValueType>;
+
+			using iterator_concept	= std::bidirectional_iterator_tag;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename List::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		private:
+			using LeafType = typename List::LeafType;
+
+		public:
+			IndexedListIterator() = default;
+
+			IndexedListIterator(LeafType* pLeaf, size_t uIndex)
+				: m_pLeaf(pLeaf), m_uIndex(uIndex) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			IndexedListIterator(const IndexedListIterator<List, bOtherConst>& other)
+				: m_pLeaf(other.m_pLeaf), m_uIndex(other.m_uIndex) { }
+
+			// Past the last element of a leaf moves to the next one, except for the last leaf where it is the end
+			IndexedListIterator& operator ++() {
+				if (++m_uIndex == m_pLeaf->uCount && m_pLeaf->pNext) {
+					m_pLeaf	 = m_pLeaf->pNext;
+					m_uIndex = 0;
+				}
+
+				return *this;
+			}
+
+			IndexedListIterator operator ++(int) {
+				IndexedListIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			IndexedListIterator& operator --() {
+				if (m_uIndex == 0) {
+					m_pLeaf	 = m_pLeaf->pPrev;
+					m_uIndex = m_pLeaf->uCount;
+				}
+
+				--m_uIndex;
+
+				return *this;
+			}
+
+			IndexedListIterator operator --(int) {
+				IndexedListIterator itr = *this;
+
+				--(*this);
+
+				return itr;
+			}
+
+			ValueType* operator ->() const {
+				return m_pLeaf->Data() + m_uIndex;
+			}
+
+			ValueType& operator *() const {
+				return m_pLeaf->Data()[m_uIndex];
+			}
+
+			bool operator ==(const IndexedListIterator& other) const {
+				return m_pLeaf == other.m_pLeaf && m_uIndex == other.m_uIndex;
+			}
+
+			bool operator !=(const IndexedListIterator& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			template<typename, bool>
+			friend class IndexedListIterator;
+
+			template<typename, size_t, typename>
+			friend class IndexedList;
+
+		private:
+			LeafType* m_pLeaf  = nullptr;
+			size_t	  m_uIndex = 0;
+	};
+
+	// Sequence with logarithmic access by index, built as a counted B+ tree. Elements sit in leaves of
+	// _LeafCapacity contiguous slots that are chained for iteration like an UnrolledList, and inner nodes keep the
+	// element count below each of their children, so an index is found by one descent and the rank of an element
+	// by one climb to the root.
+	// Full nodes split in two, except at the end of their parent where a fresh node is started so that appending
+	// leaves the nodes full. Emptied nodes are freed and neighbours under the same parent merge once they fit in
+	// three quarters of a node.
+	// Inserting and erasing invalidate iterators to the elements of the leaves involved
+	template<typename T, size_t _LeafCapacity = std::max<size_t>(detail::INDEXED_LEAF_BYTES / sizeof(T), 4), typename Alloc = Allocator<T>>
+	class IndexedList {
+		static_assert(_LeafCapacity >= 2, "Leaves have to hold at least two elements");
+
+		public:
+			using ValueType		= T;
+			using LeafType		= detail::IndexedLeaf<T, _LeafCapacity>;
+			using Iterator		= IndexedListIterator<IndexedList, false>;
+			using ConstIterator = IndexedListIterator<IndexedList, true>;
+
+			using value_type	 = T;
+			using size_type		 = size_t;
+			using iterator		 = Iterator;
+			using const_iterator = ConstIterator;
+
+			static constexpr size_t LEAF_CAPACITY = _LeafCapacity;
+
+		private:
+			using NodeBase		 = detail::IndexedNodeBase;
+			using InnerType		 = detail::IndexedInner;
+			using LeafAllocator	 = typename Alloc::template rebind<LeafType>::other;
+			using InnerAllocator = typename Alloc::template rebind<InnerType>::other;
+
+			static constexpr size_t FANOUT = detail::INDEXED_FANOUT;
+
+			// Neighbours are merged once their contents fit in this many slots
+			static constexpr size_t LEAF_MERGE_THRESHOLD  = _LeafCapacity - _LeafCapacity / 4;
+			static constexpr size_t INNER_MERGE_THRESHOLD = FANOUT - FANOUT / 4;
+
+		public:
+			IndexedList() = default;
+
+			// Constructs uCount copies of value
+			IndexedList(size_t uCount, const T& value) {
+				for (size_t i = 0; i < uCount; ++i)
+					push_back(value);
+			}
+
+			template<typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category>
+			IndexedList(InputItr first, InputItr last) {
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+
+			IndexedList(std::initializer_list<T> list)
+				: IndexedList(list.begin(), list.end()) { }
+
+			IndexedList(const IndexedList& other)
+				: IndexedList(other.begin(), other.end()) { }
+
+			IndexedList(IndexedList&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			~IndexedList() {
+				clear();
+			}
+
+			// Clears the current list, copies every element of the other one
+			IndexedList& operator =(const IndexedList& other) {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				for (const T& value : other)
+					push_back(value);
+
+				return *this;
+			}
+
+			// Clears the current list, steals the tree of the other one and leaves it empty
+			IndexedList& operator =(IndexedList&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				m_pRoot	  = std::exchange(other.m_pRoot, nullptr);
+				m_pFirst  = std::exchange(other.m_pFirst, nullptr);
+				m_pLast	  = std::exchange(other.m_pLast, nullptr);
+				m_uHeight = std::exchange(other.m_uHeight, 0);
+				m_uSize	  = std::exchange(other.m_uSize, 0);
+
+				return *this;
+			}
+
+			// Accesses the element at uIndex in logarithmic time. If uIndex is invalid, throws an exception
+			T& at(size_t uIndex) {
+				if (uIndex >= m_uSize)
+					throw std::out_of_range("Invalid index");
+
+				return *Locate(uIndex);
+			}
+
+			const T& at(size_t uIndex) const {
+				return const_cast<IndexedList*>(this)->at(uIndex);
+			}
+
+			T& operator [](size_t uIndex) {
+				return *Locate(uIndex);
+			}
+
+			const T& operator [](size_t uIndex) const {
+				return *const_cast<IndexedList*>(this)->Locate(uIndex);
+			}
+
+			// Returns an iterator to the element at uIndex, or the end for uIndex equal to the size
+			Iterator iterator_at(size_t uIndex) {
+				if (uIndex > m_uSize)
+					throw std::out_of_range("Invalid index");
+
+				return uIndex == m_uSize ? end() : Locate(uIndex);
+			}
+
+			ConstIterator iterator_at(size_t uIndex) const {
+				return const_cast<IndexedList*>(this)->iterator_at(uIndex);
+			}
+
+			// Returns the index of the element at pos, the size for the end, in logarithmic time
+			size_t rank(ConstIterator pos) const {
+				if (!pos.m_pLeaf)
+					return 0;
+
+				size_t uRank = pos.m_uIndex;
+
+				for (const NodeBase* pNode = pos.m_pLeaf; pNode->pParent; pNode = pNode->pParent) {
+					for (size_t i = 0; i < pNode->uSlot; ++i)
+						uRank += pNode->pParent->uSizes[i];
+				}
+
+				return uRank;
+			}
+
+			// Returns the index of the first element equal to value, or -1 if there is none
+			size_t find(const T& value) const {
+				size_t uIndex = 0;
+
+				for (const T& element : *this) {
+					if (element == value)
+						return uIndex;
+
+					uIndex++;
+				}
+
+				return -1;
+			}
+
+			// Returns a reference to the first element. If there are no elements, throws an exception
+			T& front() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return m_pFirst->Data()[0];
+			}
+
+			const T& front() const {
+				return const_cast<IndexedList*>(this)->front();
+			}
+
+			// Returns a reference to the last element. If there are no elements, throws an exception
+			T& back() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return m_pLast->Data()[m_pLast->uCount - 1];
+			}
+
+			const T& back() const {
+				return const_cast<IndexedList*>(this)->back();
+			}
+
+			void push_back(const T& value) {
+				emplace_back(value);
+			}
+
+			void push_back(T&& value) {
+				emplace_back(std::move(value));
+			}
+
+			template<typename... Args>
+			T& emplace_back(Args&&... args) {
+				return *emplace(cend(), std::forward<Args>(args)...);
+			}
+
+			void push_front(const T& value) {
+				emplace_front(value);
+			}
+
+			void push_front(T&& value) {
+				emplace_front(std::move(value));
+			}
+
+			template<typename... Args>
+			T& emplace_front(Args&&... args) {
+				return *emplace(cbegin(), std::forward<Args>(args)...);
+			}
+
+			// Inserts value so that it ends up at uPos. If uPos is past the end, throws an exception
+			void insert(size_t uPos, const T& value) {
+				emplace(iterator_at(uPos), value);
+			}
+
+			void insert(size_t uPos, T&& value) {
+				emplace(iterator_at(uPos), std::move(value));
+			}
+
+			Iterator insert(ConstIterator pos, const T& value) {
+				return emplace(pos, value);
+			}
+
+			Iterator insert(ConstIterator pos, T&& value) {
+				return emplace(pos, std::move(value));
+			}
+
+			// Constructs a T instance with given arguments in front of pos and returns an iterator to it
+			template<typename... Args>
+			Iterator emplace(ConstIterator pos, Args&&... args) {
+				LeafType* pLeaf	 = pos.m_pLeaf;
+				size_t	  uIndex = pos.m_uIndex;
+
+				if (!pLeaf) {
+					pLeaf = NewLeaf();
+
+					try {
+						InsertInLeaf(pLeaf, 0, std::forward<Args>(args)...);
+					}
+					catch (...) {
+						m_LeafAllocator.deallocate(pLeaf, 1);
+
+						throw;
+					}
+
+					m_pRoot	 = pLeaf;
+					m_pFirst = pLeaf;
+					m_pLast	 = pLeaf;
+					m_uSize	 = 1;
+
+					return Iterator(pLeaf, 0);
+				}
+
+				if (pLeaf->uCount == _LeafCapacity) {
+					// args may refer to an element the split moves
+					T value(std::forward<Args>(args)...);
+
+					if (uIndex == _LeafCapacity) {
+						pLeaf  = SplitLeaf(pLeaf, _LeafCapacity);
+						uIndex = 0;
+					}
+					else {
+						LeafType* pUpper = SplitLeaf(pLeaf, _LeafCapacity / 2);
+
+						if (uIndex > pLeaf->uCount) {
+							uIndex -= pLeaf->uCount;
+							pLeaf	= pUpper;
+						}
+					}
+
+					InsertInLeaf(pLeaf, uIndex, std::move(value));
+				}
+				else
+					InsertInLeaf(pLeaf, uIndex, std::forward<Args>(args)...);
+
+				AddToPath(pLeaf, 1);
+				m_uSize++;
+
+				return Iterator(pLeaf, uIndex);
+			}
+
+			// Destroys the element at uPos. If uPos is invalid, throws an exception
+			void erase(size_t uPos) {
+				if (uPos >= m_uSize)
+					throw std::out_of_range("Invalid index");
+
+				erase(Locate(uPos));
+			}
+
+			// Destroys the element at pos and returns an iterator to the one after it
+			Iterator erase(ConstIterator pos) {
+				LeafType* pLeaf	 = pos.m_pLeaf;
+				size_t	  uIndex = pos.m_uIndex;
+
+				EraseInLeaf(pLeaf, uIndex);
+				AddToPath(pLeaf, -1);
+				m_uSize--;
+
+				if (pLeaf->uCount == 0) {
+					LeafType* pNext = pLeaf->pNext;
+
+					FreeLeaf(pLeaf);
+
+					return pNext ? Iterator(pNext, 0) : end();
+				}
+
+				LeafType* pPrev = pLeaf->pPrev;
+
+				if (pPrev && pPrev->pParent == pLeaf->pParent && pPrev->uCount + pLeaf->uCount <= LEAF_MERGE_THRESHOLD) {
+					uIndex += pPrev->uCount;
+					pLeaf	= pPrev;
+
+					MergeNextLeaf(pLeaf);
+				}
+
+				LeafType* pNext = pLeaf->pNext;
+
+				if (pNext && pNext->pParent == pLeaf->pParent && pLeaf->uCount + pNext->uCount <= LEAF_MERGE_THRESHOLD)
+					MergeNextLeaf(pLeaf);
+
+				if (uIndex == pLeaf->uCount && pLeaf->pNext)
+					return Iterator(pLeaf->pNext, 0);
+
+				return Iterator(pLeaf, uIndex);
+			}
+
+			// Destroys the elements in [first; last) and returns an iterator to the one after them
+			Iterator erase(ConstIterator first, ConstIterator last) {
+				size_t	 uCount = rank(last) - rank(first);
+				Iterator itr	= Iterator(first.m_pLeaf, first.m_uIndex);
+
+				// Merging moves elements between leaves, so last can't be compared against along the way
+				while (uCount--)
+					itr = erase(itr);
+
+				return itr;
+			}
+
+			// If there are any elements, destroys the last one
+			void pop_back() {
+				if (m_uSize == 0)
+					return;
+
+				erase(ConstIterator(m_pLast, m_pLast->uCount - 1));
+			}
+
+			// If there are any elements, destroys the first one
+			void pop_front() {
+				if (m_uSize == 0)
+					return;
+
+				erase(cbegin());
+			}
+
+			// Destroys every element and frees every node
+			void clear() {
+				if (m_pRoot)
+					FreeSubtree(m_pRoot, m_uHeight);
+
+				m_pRoot	  = nullptr;
+				m_pFirst  = nullptr;
+				m_pLast	  = nullptr;
+				m_uHeight = 0;
+				m_uSize	  = 0;
+			}
+
+			void swap(IndexedList& other) noexcept {
+				std::swap(m_pRoot, other.m_pRoot);
+				std::swap(m_pFirst, other.m_pFirst);
+				std::swap(m_pLast, other.m_pLast);
+				std::swap(m_uHeight, other.m_uHeight);
+				std::swap(m_uSize, other.m_uSize);
+			}
+
+			bool empty() const {
+				return m_uSize == 0;
+			}
+
+			size_t size() const {
+				return m_uSize;
+			}
+
+			Iterator begin() {
+				return Iterator(m_pFirst, 0);
+			}
+
+			Iterator end() {
+				return m_pLast ? Iterator(m_pLast, m_pLast->uCount) : Iterator();
+			}
+
+			ConstIterator begin() const {
+				return const_cast<IndexedList*>(this)->begin();
+			}
+
+			ConstIterator end() const {
+				return const_cast<IndexedList*>(this)->end();
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			// Descends from the root, skipping the children that end before uIndex
+			Iterator Locate(size_t uIndex) {
+				NodeBase* pNode = m_pRoot;
+
+				for (size_t h = m_uHeight; h > 0; --h) {
+					InnerType* pInner = static_cast<InnerType*>(pNode);
+					size_t	   i	  = 0;
+
+					while (uIndex >= pInner->uSizes[i]) {
+						uIndex -= pInner->uSizes[i];
+						++i;
+					}
+
+					pNode = pInner->pChildren[i];
+				}
+
+				return Iterator(static_cast<LeafType*>(pNode), uIndex);
+			}
+
+			// Adds iDelta to the counts of every node above pNode
+			static void AddToPath(NodeBase* pNode, ptrdiff_t iDelta) {
+				for (; pNode->pParent; pNode = pNode->pParent)
+					pNode->pParent->uSizes[pNode->uSlot] += (size_t)iDelta;
+			}
+
+			LeafType* NewLeaf() {
+				LeafType* pLeaf = m_LeafAllocator.allocate(1);
+
+				new(pLeaf) LeafType;
+
+				return pLeaf;
+			}
+
+			InnerType* NewInner() {
+				InnerType* pInner = m_InnerAllocator.allocate(1);
+
+				new(pInner) InnerType;
+
+				return pInner;
+			}
+
+			// Moves the elements of a full leaf from uKeep on into a new leaf after it, and returns the new leaf
+			LeafType* SplitLeaf(LeafType* pLeaf, size_t uKeep) {
+				LeafType* pUpper = NewLeaf();
+				T*		  pFrom	 = pLeaf->Data();
+				T*		  pTo	 = pUpper->Data();
+
+				try {
+					InsertAfter(pLeaf, pUpper);
+				}
+				catch (...) {
+					m_LeafAllocator.deallocate(pUpper, 1);
+
+					throw;
+				}
+
+				for (size_t i = uKeep; i < pLeaf->uCount; ++i) {
+					new(pTo + i - uKeep) T(std::move(pFrom[i]));
+					pFrom[i].~T();
+				}
+
+				size_t uMoved = pLeaf->uCount - uKeep;
+
+				pUpper->uCount = uMoved;
+				pLeaf->uCount  = uKeep;
+
+				AddToPath(pLeaf, -(ptrdiff_t)uMoved);
+				AddToPath(pUpper, (ptrdiff_t)uMoved);
+
+				pUpper->pPrev = pLeaf;
+				pUpper->pNext = pLeaf->pNext;
+
+				if (pLeaf->pNext)
+					pLeaf->pNext->pPrev = pUpper;
+				else
+					m_pLast = pUpper;
+
+				pLeaf->pNext = pUpper;
+
+				return pUpper;
+			}
+
+			// Moves the children of a full inner node from uKeep on into a new inner node after it, and returns it
+			InnerType* SplitInner(InnerType* pInner, size_t uKeep) {
+				InnerType* pUpper = NewInner();
+
+				try {
+					InsertAfter(pInner, pUpper);
+				}
+				catch (...) {
+					m_InnerAllocator.deallocate(pUpper, 1);
+
+					throw;
+				}
+
+				size_t uMoved = 0;
+
+				for (size_t i = uKeep; i < pInner->uCount; ++i) {
+					uMoved += pInner->uSizes[i];
+					Adopt(pUpper, i - uKeep, pInner->pChildren[i], pInner->uSizes[i]);
+				}
+
+				pUpper->uCount = pInner->uCount - uKeep;
+				pInner->uCount = uKeep;
+
+				AddToPath(pInner, -(ptrdiff_t)uMoved);
+				AddToPath(pUpper, (ptrdiff_t)uMoved);
+
+				return pUpper;
+			}
+
+			// Hangs the empty node pNew right after pNode under the same parent, splitting full parents on the way up
+			// and growing a new root when pNode is the root
+			void InsertAfter(NodeBase* pNode, NodeBase* pNew) {
+				InnerType* pParent = pNode->pParent;
+
+				if (!pParent) {
+					pParent = NewInner();
+					pParent->uCount = 1;
+					Adopt(pParent, 0, pNode, m_uSize);
+
+					m_pRoot = pParent;
+					m_uHeight++;
+				}
+
+				size_t uSlot = pNode->uSlot + 1;
+
+				if (pParent->uCount == FANOUT) {
+					size_t	   uKeep  = uSlot == FANOUT ? FANOUT : FANOUT / 2;
+					InnerType* pUpper = SplitInner(pParent, uKeep);
+
+					if (uSlot > uKeep || uKeep == FANOUT) {
+						uSlot  -= uKeep;
+						pParent = pUpper;
+					}
+				}
+
+				for (size_t i = pParent->uCount; i > uSlot; --i)
+					Adopt(pParent, i, pParent->pChildren[i - 1], pParent->uSizes[i - 1]);
+
+				Adopt(pParent, uSlot, pNew, 0);
+				pParent->uCount++;
+			}
+
+			static void Adopt(InnerType* pParent, size_t uSlot, NodeBase* pChild, size_t uSize) {
+				pParent->pChildren[uSlot] = pChild;
+				pParent->uSizes[uSlot]	  = uSize;
+				pChild->pParent			  = pParent;
+				pChild->uSlot			  = uSlot;
+			}
+
+			// Takes a node holding no elements out of its parent. Frees parents left without children, collapses a
+			// root with a single child and merges the parent with a sibling once both fit in one
+			void Detach(NodeBase* pNode) {
+				InnerType* pParent = pNode->pParent;
+
+				if (!pParent) {
+					m_pRoot	  = nullptr;
+					m_uHeight = 0;
+
+					return;
+				}
+
+				for (size_t i = pNode->uSlot + 1; i < pParent->uCount; ++i)
+					Adopt(pParent, i - 1, pParent->pChildren[i], pParent->uSizes[i]);
+
+				pParent->uCount--;
+
+				if (pParent->uCount == 0) {
+					Detach(pParent);
+					m_InnerAllocator.deallocate(pParent, 1);
+
+					return;
+				}
+
+				if (pParent == m_pRoot) {
+					if (pParent->uCount == 1) {
+						m_pRoot			 = pParent->pChildren[0];
+						m_pRoot->pParent = nullptr;
+						m_pRoot->uSlot	 = 0;
+						m_uHeight--;
+
+						m_InnerAllocator.deallocate(pParent, 1);
+					}
+
+					return;
+				}
+
+				InnerType* pGrand = pParent->pParent;
+				size_t	   uSlot  = pParent->uSlot;
+
+				if (uSlot + 1 < pGrand->uCount && pParent->uCount + static_cast<InnerType*>(pGrand->pChildren[uSlot + 1])->uCount <= INNER_MERGE_THRESHOLD)
+					MergeNextInner(pParent);
+				else if (uSlot > 0 && static_cast<InnerType*>(pGrand->pChildren[uSlot - 1])->uCount + pParent->uCount <= INNER_MERGE_THRESHOLD)
+					MergeNextInner(static_cast<InnerType*>(pGrand->pChildren[uSlot - 1]));
+			}
+
+			// Moves the children of the inner node after pInner under the same parent to pInner and frees that node
+			void MergeNextInner(InnerType* pInner) {
+				InnerType* pParent = pInner->pParent;
+				InnerType* pNext   = static_cast<InnerType*>(pParent->pChildren[pInner->uSlot + 1]);
+
+				for (size_t i = 0; i < pNext->uCount; ++i)
+					Adopt(pInner, pInner->uCount + i, pNext->pChildren[i], pNext->uSizes[i]);
+
+				pInner->uCount				   += pNext->uCount;
+				pParent->uSizes[pInner->uSlot] += pParent->uSizes[pNext->uSlot];
+				pParent->uSizes[pNext->uSlot]	= 0;
+
+				Detach(pNext);
+				m_InnerAllocator.deallocate(pNext, 1);
+			}
+
+			// Moves every element of the leaf after pLeaf, which has the same parent, to its end and frees that leaf
+			void MergeNextLeaf(LeafType* pLeaf) {
+				LeafType* pNext	 = pLeaf->pNext;
+				T*		  pFrom	 = pNext->Data();
+				T*		  pTo	 = pLeaf->Data() + pLeaf->uCount;
+				size_t	  uMoved = pNext->uCount;
+
+				for (size_t i = 0; i < uMoved; ++i) {
+					new(pTo + i) T(std::move(pFrom[i]));
+					pFrom[i].~T();
+				}
+
+				pLeaf->uCount += uMoved;
+				pNext->uCount  = 0;
+
+				pLeaf->pParent->uSizes[pLeaf->uSlot] += uMoved;
+				pNext->pParent->uSizes[pNext->uSlot] -= uMoved;
+
+				FreeLeaf(pNext);
+			}
+
+			// Unchains, detaches and deallocates a leaf whose elements are already destroyed or moved out
+			void FreeLeaf(LeafType* pLeaf) {
+				if (pLeaf->pPrev)
+					pLeaf->pPrev->pNext = pLeaf->pNext;
+				else
+					m_pFirst = pLeaf->pNext;
+
+				if (pLeaf->pNext)
+					pLeaf->pNext->pPrev = pLeaf->pPrev;
+				else
+					m_pLast = pLeaf->pPrev;
+
+				Detach(pLeaf);
+				m_LeafAllocator.deallocate(pLeaf, 1);
+			}
+
+			void FreeSubtree(NodeBase* pNode, size_t uHeight) {
+				if (uHeight == 0) {
+					LeafType* pLeaf = static_cast<LeafType*>(pNode);
+					T*		  pData = pLeaf->Data();
+
+					for (size_t i = 0; i < pLeaf->uCount; ++i)
+						pData[i].~T();
+
+					m_LeafAllocator.deallocate(pLeaf, 1);
+
+					return;
+				}
+
+				InnerType* pInner = static_cast<InnerType*>(pNode);
+
+				for (size_t i = 0; i < pInner->uCount; ++i)
+					FreeSubtree(pInner->pChildren[i], uHeight - 1);
+
+				m_InnerAllocator.deallocate(pInner, 1);
+			}
+
+			// Shifts the elements from uIndex on one slot up and constructs the new one in the gap.
+			// The value is built first, args may refer to an element about to move
+			template<typename... Args>
+			static void InsertInLeaf(LeafType* pLeaf, size_t uIndex, Args&&... args) {
+				T*	   pData  = pLeaf->Data();
+				size_t uCount = pLeaf->uCount;
+
+				if (uIndex == uCount) {
+					new(pData + uCount) T(std::forward<Args>(args)...);
+				}
+				else {
+					T value(std::forward<Args>(args)...);
+
+					new(pData + uCount) T(std::move(pData[uCount - 1]));
+					std::move_backward(pData + uIndex, pData + uCount - 1, pData + uCount);
+					pData[uIndex] = std::move(value);
+				}
+
+				pLeaf->uCount++;
+			}
+
+			static void EraseInLeaf(LeafType* pLeaf, size_t uIndex) {
+				T* pData = pLeaf->Data();
+
+				std::move(pData + uIndex + 1, pData + pLeaf->uCount, pData + uIndex);
+				pData[--pLeaf->uCount].~T();
+			}
+
+		private:
+			NodeBase* m_pRoot	= nullptr;
+			LeafType* m_pFirst	= nullptr;
+			LeafType* m_pLast	= nullptr;
+			size_t	  m_uHeight = 0;
+			size_t	  m_uSize	= 0;
+
+			LeafAllocator  m_LeafAllocator;
+			InnerAllocator m_InnerAllocator;
+	};
+}
\ No newline at end of file
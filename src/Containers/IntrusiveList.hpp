@@ -0,0 +1,457 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../Memory/Memory.hpp"
+
+namespace nstd {
+	template<typename T, auto Hook>
+	class IntrusiveList;
+
+	// Links embedded in objects that go into an IntrusiveList. An object can sit in one list per hook member.
+	// Lists are circular around a hook of their own, so a linked hook can be taken out without knowing its list.
+	// Copying an object gives the copy an unlinked hook, and assigning leaves the target's links alone.
+	// With bAutoUnlink, the hook takes itself out of its list when the object dies and can be unlinked directly,
+	// which means lists of such hooks can't keep count of their elements
+	template<bool bAutoUnlink>
+	class BasicListHook {
+		public:
+			BasicListHook() = default;
+
+			BasicListHook(const BasicListHook&) noexcept { }
+
+			BasicListHook& operator =(const BasicListHook&) noexcept {
+				return *this;
+			}
+
+			// Plain hooks have to be erased from their list before the object dies
+			~BasicListHook() {
+				if constexpr (bAutoUnlink) {
+					if (is_linked())
+						Unlink();
+				}
+			}
+
+			bool is_linked() const {
+				return m_pNext != nullptr;
+			}
+
+			// Takes the object out of whatever list it is in. Only auto-unlink hooks, the others go through their list
+			void unlink() {
+				static_assert(bAutoUnlink, "Only auto-unlink hooks can be unlinked without their list");
+
+				if (is_linked())
+					Unlink();
+			}
+
+		private:
+			template<typename, auto>
+			friend class IntrusiveList;
+
+			template<typename, bool>
+			friend class IntrusiveListIterator;
+
+			void LinkBefore(BasicListHook* pNext) {
+				m_pPrev			 = pNext->m_pPrev;
+				m_pNext			 = pNext;
+				m_pPrev->m_pNext = this;
+				pNext->m_pPrev	 = this;
+			}
+
+			void Unlink() {
+				m_pPrev->m_pNext = m_pNext;
+				m_pNext->m_pPrev = m_pPrev;
+				m_pPrev			 = nullptr;
+				m_pNext			 = nullptr;
+			}
+
+		private:
+			BasicListHook* m_pPrev = nullptr;
+			BasicListHook* m_pNext = nullptr;
+	};
+
+	using ListHook			 = BasicListHook<false>;
+	using AutoUnlinkListHook = BasicListHook<true>;
+
+	namespace detail {
+		template<typename>
+		struct ListHookTraits;
+
+		template<typename T, bool bAutoUnlink>
+		struct ListHookTraits<BasicListHook<bAutoUnlink> T::*> {
+			using HookType = BasicListHook<bAutoUnlink>;
+
+			static constexpr bool AUTO_UNLINK = bAutoUnlink;
+		};
+	}
+
+	template<typename List, bool bConst>
+	class IntrusiveListIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename List::ValueType, typename List::ValueType>;
+
+			using iterator_concept	= std::bidirectional_iterator_tag;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename List::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		private:
+			using HookType = typename List::HookType;
+
+		public:
+			IntrusiveListIterator() = default;
+
+			explicit IntrusiveListIterator(HookType* pHook)
+				: m_pHook(pHook) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			IntrusiveListIterator(const IntrusiveListIterator<List, bOtherConst>& other)
+				: m_pHook(other.m_pHook) { }
+
+			IntrusiveListIterator& operator ++() {
+				m_pHook = m_pHook->m_pNext;
+
+				return *this;
+			}
+
+			IntrusiveListIterator operator ++(int) {
+				IntrusiveListIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			IntrusiveListIterator& operator --() {
+				m_pHook = m_pHook->m_pPrev;
+
+				return *this;
+			}
+
+			IntrusiveListIterator operator --(int) {
+				IntrusiveListIterator itr = *this;
+
+				--(*this);
+
+				return itr;
+			}
+
+			ValueType* operator ->() const {
+				return List::ObjectOf(m_pHook);
+			}
+
+			ValueType& operator *() const {
+				return *List::ObjectOf(m_pHook);
+			}
+
+			bool operator ==(const IntrusiveListIterator& other) const {
+				return m_pHook == other.m_pHook;
+			}
+
+			bool operator !=(const IntrusiveListIterator& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			template<typename, bool>
+			friend class IntrusiveListIterator;
+
+			template<typename, auto>
+			friend class IntrusiveList;
+
+		private:
+			HookType* m_pHook = nullptr;
+	};
+
+	// Doubly linked list of caller-owned objects, linked through their Hook member (a ListHook or AutoUnlinkListHook).
+	// Nothing is allocated or copied: linking and unlinking rewrite four pointers, and the objects must stay alive
+	// while linked. Destroying or clearing the list unlinks the objects without touching them otherwise.
+	// Lists of plain hooks keep their size, lists of auto-unlink hooks count their elements on demand since the
+	// objects can leave on their own
+	template<typename T, auto Hook>
+	class IntrusiveList {
+		private:
+			using HookTraits = detail::ListHookTraits<decltype(Hook)>;
+
+		public:
+			using ValueType		= T;
+			using HookType		= typename HookTraits::HookType;
+			using Iterator		= IntrusiveListIterator<IntrusiveList, false>;
+			using ConstIterator = IntrusiveListIterator<IntrusiveList, true>;
+
+			using value_type	 = T;
+			using size_type		 = size_t;
+			using iterator		 = Iterator;
+			using const_iterator = ConstIterator;
+
+			static constexpr bool AUTO_UNLINK = HookTraits::AUTO_UNLINK;
+
+		public:
+			IntrusiveList() {
+				m_Root.m_pPrev = &m_Root;
+				m_Root.m_pNext = &m_Root;
+			}
+
+			IntrusiveList(const IntrusiveList&) = delete;
+			IntrusiveList& operator =(const IntrusiveList&) = delete;
+
+			IntrusiveList(IntrusiveList&& other) noexcept
+				: IntrusiveList() {
+				swap(other);
+			}
+
+			~IntrusiveList() {
+				clear();
+			}
+
+			// Unlinks the current objects and takes over those of the other list, leaving it empty
+			IntrusiveList& operator =(IntrusiveList&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				clear();
+				swap(other);
+
+				return *this;
+			}
+
+			// Returns a reference to the first object. If there are no objects, throws an exception
+			T& front() {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return *ObjectOf(m_Root.m_pNext);
+			}
+
+			const T& front() const {
+				return const_cast<IntrusiveList*>(this)->front();
+			}
+
+			// Returns a reference to the last object. If there are no objects, throws an exception
+			T& back() {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return *ObjectOf(m_Root.m_pPrev);
+			}
+
+			const T& back() const {
+				return const_cast<IntrusiveList*>(this)->back();
+			}
+
+			void push_back(T& object) {
+				insert(cend(), object);
+			}
+
+			void push_front(T& object) {
+				insert(cbegin(), object);
+			}
+
+			// If there are any objects, unlinks the last one
+			void pop_back() {
+				if (!empty())
+					erase(ConstIterator(m_Root.m_pPrev));
+			}
+
+			// If there are any objects, unlinks the first one
+			void pop_front() {
+				if (!empty())
+					erase(cbegin());
+			}
+
+			// Links object in front of pos and returns an iterator to it. The object must not be linked through Hook yet
+			Iterator insert(ConstIterator pos, T& object) {
+				HookType* pHook = &(object.*Hook);
+
+				pHook->LinkBefore(pos.m_pHook);
+				m_uSize++;
+
+				return Iterator(pHook);
+			}
+
+			// Unlinks the object at pos and returns an iterator to the one after it
+			Iterator erase(ConstIterator pos) {
+				HookType* pNext = pos.m_pHook->m_pNext;
+
+				pos.m_pHook->Unlink();
+				m_uSize--;
+
+				return Iterator(pNext);
+			}
+
+			// Unlinks the objects in [first; last) and returns last
+			Iterator erase(ConstIterator first, ConstIterator last) {
+				while (first != last)
+					first = erase(first);
+
+				return Iterator(last.m_pHook);
+			}
+
+			// Unlinks object, which has to be in this list
+			void remove(T& object) {
+				erase(iterator_to(object));
+			}
+
+			// Returns an iterator to an object linked in this list, in constant time
+			Iterator iterator_to(T& object) {
+				return Iterator(&(object.*Hook));
+			}
+
+			ConstIterator iterator_to(const T& object) const {
+				return ConstIterator(const_cast<HookType*>(&(object.*Hook)));
+			}
+
+			// Moves every object of other in front of pos, leaving other empty
+			void splice(ConstIterator pos, IntrusiveList& other) {
+				if (this == &other || other.empty())
+					return;
+
+				m_uSize		 += other.m_uSize;
+				other.m_uSize = 0;
+
+				LinkRangeBefore(pos.m_pHook, other.m_Root.m_pNext, other.m_Root.m_pPrev);
+			}
+
+			// Moves the object at itr in other in front of pos
+			void splice(ConstIterator pos, IntrusiveList& other, ConstIterator itr) {
+				if (pos == itr)
+					return;
+
+				HookType* pHook = itr.m_pHook;
+
+				pHook->Unlink();
+				pHook->LinkBefore(pos.m_pHook);
+
+				other.m_uSize--;
+				m_uSize++;
+			}
+
+			// Moves the objects in [first; last) of other in front of pos, which must not be one of them.
+			// Walks the range to count it unless the hooks are auto-unlink
+			void splice(ConstIterator pos, IntrusiveList& other, ConstIterator first, ConstIterator last) {
+				if (first == last)
+					return;
+
+				if constexpr (!AUTO_UNLINK) {
+					if (this != &other) {
+						size_t uCount = (size_t)std::distance(first, last);
+
+						other.m_uSize -= uCount;
+						m_uSize		  += uCount;
+					}
+				}
+
+				LinkRangeBefore(pos.m_pHook, first.m_pHook, last.m_pHook->m_pPrev);
+			}
+
+			// Unlinks every object
+			void clear() {
+				HookType* pHook = m_Root.m_pNext;
+
+				while (pHook != &m_Root) {
+					HookType* pNext = pHook->m_pNext;
+
+					pHook->m_pPrev = nullptr;
+					pHook->m_pNext = nullptr;
+					pHook		   = pNext;
+				}
+
+				m_Root.m_pPrev = &m_Root;
+				m_Root.m_pNext = &m_Root;
+				m_uSize		   = 0;
+			}
+
+			void swap(IntrusiveList& other) noexcept {
+				if (this == &other)
+					return;
+
+				std::swap(m_Root.m_pPrev, other.m_Root.m_pPrev);
+				std::swap(m_Root.m_pNext, other.m_Root.m_pNext);
+
+				Reroot(&other.m_Root);
+				other.Reroot(&m_Root);
+
+				std::swap(m_uSize, other.m_uSize);
+			}
+
+			bool empty() const {
+				return m_Root.m_pNext == &m_Root;
+			}
+
+			// Constant time for plain hooks, a walk over the list for auto-unlink ones
+			size_t size() const {
+				if constexpr (AUTO_UNLINK)
+					return (size_t)std::distance(begin(), end());
+				else
+					return m_uSize;
+			}
+
+			Iterator begin() {
+				return Iterator(m_Root.m_pNext);
+			}
+
+			Iterator end() {
+				return Iterator(&m_Root);
+			}
+
+			ConstIterator begin() const {
+				return const_cast<IntrusiveList*>(this)->begin();
+			}
+
+			ConstIterator end() const {
+				return const_cast<IntrusiveList*>(this)->end();
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			template<typename, bool>
+			friend class IntrusiveListIterator;
+
+			static T* ObjectOf(HookType* pHook) {
+				return owner_of(pHook, Hook);
+			}
+
+			// Points the ends of a chain taken over from the list with pOldRoot back at this list's root
+			void Reroot(HookType* pOldRoot) {
+				if (m_Root.m_pNext == pOldRoot) {
+					m_Root.m_pPrev = &m_Root;
+					m_Root.m_pNext = &m_Root;
+				}
+				else {
+					m_Root.m_pNext->m_pPrev = &m_Root;
+					m_Root.m_pPrev->m_pNext = &m_Root;
+				}
+			}
+
+			// Cuts the chain [pFirst; pLast] out of wherever it is linked and puts it in front of pNext
+			static void LinkRangeBefore(HookType* pNext, HookType* pFirst, HookType* pLast) {
+				pFirst->m_pPrev->m_pNext = pLast->m_pNext;
+				pLast->m_pNext->m_pPrev	 = pFirst->m_pPrev;
+
+				pFirst->m_pPrev			= pNext->m_pPrev;
+				pLast->m_pNext			= pNext;
+				pNext->m_pPrev->m_pNext = pFirst;
+				pNext->m_pPrev			= pLast;
+			}
+
+		private:
+			HookType m_Root;
+
+			// Unused with auto-unlink hooks
+			size_t m_uSize = 0;
+	};
+}
\ No newline at end of file
@@ -1,8 +1,12 @@
 #pragma once
 
 #include <memory>
+#include <string>
+#include <iterator>
 #include <functional>
-#include <fstream>
+#include <type_traits>
+
+#include "../Memory/ChunkArena.hpp"
 
 struct input_iterator_tag {};
 
@@ -12,6 +16,9 @@ struct forward_iterator_tag : input_iterator_tag {};
 
 struct bidirectional_iterator_tag : forward_iterator_tag {};
 
+template<typename List>
+class ConstListIterator;
+
 template<typename List>
 class ListIterator
 {
@@ -36,7 +43,7 @@ class ListIterator
 			return *this;
 		}
 
-		ListIterator& operator++ (int)
+		ListIterator operator++ (int)
 		{
 			ListIterator temp = *this;
 
@@ -55,7 +62,7 @@ class ListIterator
 			return *this;
 		}
 
-		ListIterator& operator-- (int)
+		ListIterator operator-- (int)
 		{
 			ListIterator temp = *this;
 
@@ -74,17 +81,20 @@ class ListIterator
 			return &(m_Ptr->value);
 		}
 
-		bool operator== (const ListIterator& other)
+		bool operator== (const ListIterator& other) const
 		{
 			return m_Ptr == other.m_Ptr;
 		}
 
-		bool operator!= (const ListIterator& other)
+		bool operator!= (const ListIterator& other) const
 		{
 			return m_Ptr != other.m_Ptr;
 		}
 
 	private:
+		friend List;
+		friend class ConstListIterator<List>;
+
 		std::shared_ptr<node_type> m_Ptr;
 		std::shared_ptr<node_type> m_TailPtr;
 };
@@ -106,6 +116,11 @@ class ConstListIterator
 			: m_Ptr(node), m_TailPtr(tailPtr)
 		{}
 
+		// Every iterator converts to a const one, so positions can be given as either
+		ConstListIterator(const ListIterator<List>& other)
+			: m_Ptr(other.m_Ptr), m_TailPtr(other.m_TailPtr)
+		{}
+
 		ConstListIterator& operator++ ()
 		{
 			m_Ptr = m_Ptr->next;
@@ -113,7 +128,7 @@ class ConstListIterator
 			return *this;
 		}
 
-		ConstListIterator& operator++ (int)
+		ConstListIterator operator++ (int)
 		{
 			ConstListIterator temp = *this;
 
@@ -132,7 +147,7 @@ class ConstListIterator
 			return *this;
 		}
 
-		ConstListIterator& operator-- (int)
+		ConstListIterator operator-- (int)
 		{
 			ConstListIterator temp = *this;
 
@@ -151,17 +166,19 @@ class ConstListIterator
 			return &(m_Ptr->value);
 		}
 
-		bool operator== (const ConstListIterator& other)
+		bool operator== (const ConstListIterator& other) const
 		{
 			return m_Ptr == other.m_Ptr;
 		}
 
-		bool operator!= (const ConstListIterator& other)
+		bool operator!= (const ConstListIterator& other) const
 		{
 			return m_Ptr != other.m_Ptr;
 		}
 
 	private:
+		friend List;
+
 		std::shared_ptr<node_type> m_Ptr;
 		std::shared_ptr<node_type> m_TailPtr;
 };
@@ -190,11 +207,11 @@ class ReverseListIterator
 			return *this;
 		}
 
-		ReverseListIterator& operator++ (int)
+		ReverseListIterator operator++ (int)
 		{
 			ReverseListIterator temp = *this;
 
-			--(*this);
+			++(*this);
 
 			return temp;
 		}
@@ -209,11 +226,11 @@ class ReverseListIterator
 			return *this;
 		}
 
-		ReverseListIterator& operator-- (int)
+		ReverseListIterator operator-- (int)
 		{
 			ReverseListIterator temp = *this;
 
-			++(*this);
+			--(*this);
 
 			return temp;
 		}
@@ -228,12 +245,12 @@ class ReverseListIterator
 			return &(m_Ptr->value);
 		}
 
-		bool operator== (const ReverseListIterator& other)
+		bool operator== (const ReverseListIterator& other) const
 		{
 			return m_Ptr == other.m_Ptr;
 		}
 
-		bool operator!= (const ReverseListIterator& other)
+		bool operator!= (const ReverseListIterator& other) const
 		{
 			return m_Ptr != other.m_Ptr;
 		}
@@ -267,11 +284,11 @@ class ConstReverseListIterator
 			return *this;
 		}
 
-		ConstReverseListIterator& operator++ (int)
+		ConstReverseListIterator operator++ (int)
 		{
 			ConstReverseListIterator temp = *this;
 
-			--(*this);
+			++(*this);
 
 			return temp;
 		}
@@ -286,31 +303,31 @@ class ConstReverseListIterator
 			return *this;
 		}
 
-		ConstReverseListIterator& operator-- (int)
+		ConstReverseListIterator operator-- (int)
 		{
 			ConstReverseListIterator temp = *this;
 
-			++(*this);
+			--(*this);
 
 			return temp;
 		}
 
-		const_reference operator* ()
+		const_reference operator* () const
 		{
 			return m_Ptr->value;
 		}
 
-		const_pointer operator-> ()
+		const_pointer operator-> () const
 		{
 			return &(m_Ptr->value);
 		}
 
-		bool operator== (const ConstReverseListIterator& other)
+		bool operator== (const ConstReverseListIterator& other) const
 		{
 			return m_Ptr == other.m_Ptr;
 		}
 
-		bool operator!= (const ConstReverseListIterator& other)
+		bool operator!= (const ConstReverseListIterator& other) const
 		{
 			return m_Ptr != other.m_Ptr;
 		}
@@ -373,6 +390,13 @@ class List
 			*this = list;
 		}
 
+		// Constructs the list from the elements in [first; last), look for append_range
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		List(InputIt first, InputIt last)
+		{
+			append_range(first, last);
+		}
+
 		// Clears current container and copies every element of the other one
 		List& operator= (const List& other)
 		{
@@ -380,14 +404,7 @@ class List
 				return *this;
 
 			clear();
-
-			std::shared_ptr<ListNode> node = other.m_Head;
-
-			while(node)
-			{
-				push_back(node->value);
-				node = node->next;
-			}
+			AppendNodes(other.cbegin(), other.cend(), other.m_Size);
 
 			return *this;
 		}
@@ -413,13 +430,40 @@ class List
 		List& operator= (std::initializer_list<T> list)
 		{
 			clear();
-
-			for(const T& el : list)
-				push_back(el);
+			AppendNodes(list.begin(), list.end(), list.size());
 
 			return *this;
 		}
 
+		// Replaces the elements with those in [first; last)
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		void assign(InputIt first, InputIt last)
+		{
+			clear();
+			append_range(first, last);
+		}
+
+		void assign(std::initializer_list<T> list)
+		{
+			*this = list;
+		}
+
+		// Appends copies of the elements in [first; last), linking each node as it is built.
+		// Ranges of more than about a thousand small elements have their nodes, control blocks included, carved out of
+		// shared 64 KiB chunks instead of allocated one by one. A chunk goes back to the heap in one piece once all of
+		// its nodes are gone, so only lists that are mostly erased together should be built this way
+		template<typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+		void append_range(InputIt first, InputIt last)
+		{
+			AppendNodes(first, last, KnownDistance(first, last));
+		}
+
+		template<typename Range>
+		void append_range(const Range& range)
+		{
+			append_range(range.begin(), range.end());
+		}
+
 		// Clears this container
 		~List()
 		{
@@ -456,12 +500,7 @@ class List
 			if(ind >= m_Size)
 				throw std::out_of_range("Index out of list's range");
 
-			iterator itr = begin();
-
-			while(ind-- && itr != end())
-				++itr;
-
-			return *itr;
+			return NodeAt(ind)->value;
 		}
 
 		// Returns a const reference to the n-th element of the list, might throw if index out of range
@@ -470,12 +509,7 @@ class List
 			if(ind >= m_Size)
 				throw std::out_of_range("Index out of list's range");
 
-			const_iterator itr = begin();
-
-			while(ind-- && itr != cend())
-				++itr;
-
-			return *itr;
+			return NodeAt(ind)->value;
 		}
 
 		// Returns a index of the first found occurrence of given val. Returns -1 if none found
@@ -512,6 +546,7 @@ class List
 			while(m_Head)
 				m_Head = std::move(m_Head->next);
 
+			m_Tail = nullptr;
 			m_Size = 0;
 		}
 
@@ -535,19 +570,7 @@ class List
 				return;
 			}
 
-			std::shared_ptr<ListNode> node = std::make_shared<ListNode>(val);
-			std::shared_ptr<ListNode> ptr  = m_Head;
-
-			while(pos--)
-				ptr = ptr->next;
-
-			node->next = ptr;
-			node->prev = ptr->prev;
-
-			ptr->prev.lock()->next = node;
-			ptr->prev = node;
-
-			m_Size++;
+			LinkBefore(NodeAt(pos), std::make_shared<ListNode>(val));
 		}
 
 		// Same as before, but moves the given val
@@ -558,31 +581,19 @@ class List
 
 			if(pos == 0)
 			{
-				push_front(val);
+				push_front(std::move(val));
 
 				return;
 			}
 
 			if(pos == m_Size)
 			{
-				push_back(val);
+				push_back(std::move(val));
 
 				return;
 			}
 
-			std::shared_ptr<ListNode> node = std::make_shared<ListNode>(std::move(val));
-			std::shared_ptr<ListNode> ptr  = m_Head;
-
-			while(pos--)
-				ptr = ptr->next;
-
-			node->next = ptr;
-			node->prev = ptr->prev;
-
-			ptr->prev.lock()->next = node;
-			ptr->prev = node;
-
-			m_Size++;
+			LinkBefore(NodeAt(pos), std::make_shared<ListNode>(std::move(val)));
 		}
 
 		// Inserts element at the front of this list
@@ -646,6 +657,7 @@ class List
 			m_Head->prev = node;
 			node->next = m_Head;
 			m_Head = node;
+			m_Size++;
 
 			return m_Head->value;
 		}
@@ -658,32 +670,16 @@ class List
 				throw std::out_of_range("Index out of list's range");
 
 			if(pos == 0)
-			{
-				emplace_front(std::forward<Args>(args)...);
-
-				return;
-			}
+				return emplace_front(std::forward<Args>(args)...);
 
 			if(pos == m_Size)
-			{
-				emplace_back(std::forward<Args>(args)...);
-
-				return;
-			}
+				return emplace_back(std::forward<Args>(args)...);
 
 			std::shared_ptr<ListNode> node = std::make_shared<ListNode>(std::forward<Args>(args)...);
-			std::shared_ptr<ListNode> ptr = m_Head;
 
-			while(pos--)
-				ptr = ptr->next;
+			LinkBefore(NodeAt(pos), node);
 
-			node->next = ptr;
-			node->prev = ptr->prev;
-
-			ptr->prev.lock()->next = node;
-			ptr->prev = node;
-
-			m_Size++;
+			return node->value;
 		}
 
 		// Pushes element to the back of the list
@@ -747,6 +743,7 @@ class List
 			m_Tail->next = node;
 			node->prev = m_Tail;
 			m_Tail = node;
+			m_Size++;
 
 			return m_Tail->value;
 		}
@@ -758,6 +755,12 @@ class List
 				return;
 
 			m_Head = std::move(m_Head->next);
+
+			if(m_Head)
+				m_Head->prev.reset();
+			else
+				m_Tail = nullptr;
+
 			m_Size--;
 		}
 
@@ -767,8 +770,13 @@ class List
 			if(!m_Size)
 				return;
 
-			m_Tail = std::move(m_Tail->prev.lock());
-			m_Tail->next = std::shared_ptr<ListNode>(nullptr);
+			m_Tail = m_Tail->prev.lock();
+
+			if(m_Tail)
+				m_Tail->next = nullptr;
+			else
+				m_Head = nullptr;
+
 			m_Size--;
 		}
 
@@ -792,66 +800,253 @@ class List
 				return;
 			}
 
-			std::shared_ptr<ListNode> node = m_Head;
+			std::shared_ptr<ListNode> node = NodeAt(pos);
 
-			while(pos--)
-				node = node->next;
+			UnlinkRange(node, node, 1);
+		}
 
-			node->prev.lock()->next = node->next;
-			node->next->prev = node->prev;
+		// Inserts val in front of pos and returns an iterator to it. Only relinks the neighbours of pos
+		iterator insert(const_iterator pos, const T& val)
+		{
+			return emplace(pos, val);
 		}
 
-		// Sorts list with given, or default, compaaring funcition using quick sort
-		void sort(std::function<bool(const T&, const T&)> comp = [](const T& lhs, const T& rhs) { return lhs <= rhs; })
+		// Same as before, but moves the given val
+		iterator insert(const_iterator pos, T&& val)
 		{
-			QuickSort(m_Head, m_Tail, comp);
+			return emplace(pos, std::move(val));
 		}
 
-		// Swaps two lists
-		void swap(List& other) noexcept
+		// Constructs element in-place in front of pos and returns an iterator to it
+		template<typename... Args>
+		iterator emplace(const_iterator pos, Args&&... args)
+		{
+			std::shared_ptr<ListNode> node = std::make_shared<ListNode>(std::forward<Args>(args)...);
+
+			LinkBefore(pos.m_Ptr, node);
+
+			return iterator(node, m_Tail);
+		}
+
+		// Erases the element at pos and returns an iterator to the one after it
+		iterator erase(const_iterator pos)
+		{
+			std::shared_ptr<ListNode> node = pos.m_Ptr;
+			std::shared_ptr<ListNode> next = node->next;
+
+			UnlinkRange(node, node, 1);
+
+			return iterator(next, m_Tail);
+		}
+
+		// Erases the elements in [first; last) and returns last
+		iterator erase(const_iterator first, const_iterator last)
+		{
+			while(first != last)
+				first = erase(first);
+
+			return iterator(last.m_Ptr, m_Tail);
+		}
+
+		// Moves every element of other in front of pos, leaving other empty. Nodes are relinked, not copied
+		void splice(const_iterator pos, List& other)
+		{
+			if(this == &other || other.empty())
+				return;
+
+			std::shared_ptr<ListNode> first = other.m_Head;
+			std::shared_ptr<ListNode> last	= other.m_Tail;
+			size_t count					= other.m_Size;
+
+			other.m_Head = other.m_Tail = nullptr;
+			other.m_Size = 0;
+
+			LinkRangeBefore(pos.m_Ptr, first, last, count);
+		}
+
+		void splice(const_iterator pos, List&& other)
+		{
+			splice(pos, other);
+		}
+
+		// Moves the element at itr, which belongs to other (or this list), in front of pos
+		void splice(const_iterator pos, List& other, const_iterator itr)
+		{
+			std::shared_ptr<ListNode> node = itr.m_Ptr;
+
+			// Already in place
+			if(this == &other && (node == pos.m_Ptr || node->next == pos.m_Ptr))
+				return;
+
+			other.UnlinkRange(node, node, 1);
+			LinkRangeBefore(pos.m_Ptr, node, node, 1);
+		}
+
+		void splice(const_iterator pos, List&& other, const_iterator itr)
+		{
+			splice(pos, other, itr);
+		}
+
+		// Moves the elements in [first; last) of other (or this list, with pos outside the range) in front of pos.
+		// Constant time within a list, linear in the range's length between two lists to keep the sizes right
+		void splice(const_iterator pos, List& other, const_iterator first, const_iterator last)
+		{
+			if(first == last)
+				return;
+
+			std::shared_ptr<ListNode> firstNode = first.m_Ptr;
+			std::shared_ptr<ListNode> lastNode	= last.m_Ptr ? last.m_Ptr->prev.lock() : other.m_Tail;
+			size_t count						= 0;
+
+			if(this != &other)
+			{
+				for(const_iterator itr = first; itr != last; ++itr)
+					count++;
+			}
+
+			other.UnlinkRange(firstNode, lastNode, count);
+			LinkRangeBefore(pos.m_Ptr, firstNode, lastNode, count);
+		}
+
+		void splice(const_iterator pos, List&& other, const_iterator first, const_iterator last)
+		{
+			splice(pos, other, first, last);
+		}
+
+		// Merges sorted other into this sorted list by relinking its nodes, leaving other empty.
+		// Equivalent elements of this list stay in front of those of other
+		template<typename Compare = std::less<T>>
+		void merge(List& other, Compare comp = Compare{})
 		{
 			if(this == &other)
 				return;
 
-			std::swap(m_Head, other.m_Head);
-			std::swap(m_Tail, other.m_Tail);
-			std::swap(m_Size, other.m_Size);
+			std::shared_ptr<ListNode> node = m_Head;
+
+			while(node && other.m_Head)
+			{
+				if(comp(other.m_Head->value, node->value))
+				{
+					std::shared_ptr<ListNode> moved = other.m_Head;
+
+					other.UnlinkRange(moved, moved, 1);
+					LinkRangeBefore(node, moved, moved, 1);
+				}
+				else
+				{
+					node = node->next;
+				}
+			}
+
+			splice(cend(), other);
+		}
+
+		template<typename Compare = std::less<T>>
+		void merge(List&& other, Compare comp = Compare{})
+		{
+			merge(other, comp);
 		}
 
-		// Reads bytes and loads them as new list elements
-		bool read_from_binary_file(const std::string& filename)
+		// Reverses the order of the elements by swapping the links of every node
+		void reverse() noexcept
 		{
-			std::fstream file(filename, std::ios::in | std::ios::binary);
+			// prev keeps each reversed node alive until the following one links to it
+			std::shared_ptr<ListNode> node = m_Head;
+			std::shared_ptr<ListNode> prev;
+
+			while(node)
+			{
+				std::shared_ptr<ListNode> next = node->next;
 
-			if(!file.good())
-				return false;
+				node->next = prev;
+				node->prev = next;
+				prev	   = node;
+				node	   = next;
+			}
 
-			T temp;
+			std::swap(m_Head, m_Tail);
+		}
 
-			while(file.read((char*)&temp, sizeof(T)))
-				push_back(std::move(temp));
+		// Erases every element for which pred returns true. Returns the number of erased elements
+		template<typename Predicate>
+		size_t remove_if(Predicate pred)
+		{
+			size_t count = 0;
 
-			file.close();
+			for(const_iterator itr = cbegin(); itr != cend();)
+			{
+				if(pred(*itr))
+				{
+					itr = erase(itr);
+					count++;
+				}
+				else
+				{
+					++itr;
+				}
+			}
 
-			return true;
+			return count;
 		}
 
-		// Saves list's elements bytes into file
-		bool write_to_binary_file(const std::string& filename)
+		// Erases every element equal to val. Returns the number of erased elements
+		size_t remove(const T& val)
 		{
-			std::fstream file(filename, std::ios::out | std::ios::binary);
+			return remove_if([&val](const T& el) { return el == val; });
+		}
+
+		// Erases every element for which pred(previous, element) returns true, by default all but the first of
+		// each run of equal elements. Returns the number of erased elements
+		template<typename BinaryPredicate = std::equal_to<T>>
+		size_t unique(BinaryPredicate pred = BinaryPredicate{})
+		{
+			size_t count = 0;
+			std::shared_ptr<ListNode> node = m_Head;
+
+			while(node && node->next)
+			{
+				if(pred(node->value, node->next->value))
+				{
+					std::shared_ptr<ListNode> next = node->next;
 
-			if(!file.good())
-				return false;
+					UnlinkRange(next, next, 1);
+					count++;
+				}
+				else
+				{
+					node = node->next;
+				}
+			}
 
-			for(const T& el : *this)
-				file.write((char*)&el, sizeof(T));
+			return count;
+		}
 
-			file.close();
+		// Sorts list with given, or default, compaaring funcition using quick sort
+		void sort(std::function<bool(const T&, const T&)> comp = [](const T& lhs, const T& rhs) { return lhs <= rhs; })
+		{
+			QuickSort(m_Head, m_Tail, comp);
+		}
+
+		// Swaps two lists
+		void swap(List& other) noexcept
+		{
+			if(this == &other)
+				return;
 
-			return true;
+			std::swap(m_Head, other.m_Head);
+			std::swap(m_Tail, other.m_Tail);
+			std::swap(m_Size, other.m_Size);
 		}
 
+		// Appends the elements saved to the file by write_to_binary_file. Returns false, leaving the list as it was,
+		// if the file can't be read, was saved for a different T or fails its checksum.
+		// Defined in IO/Serialization.hpp, which callers have to include, look for: nstd::load
+		bool read_from_binary_file(const std::string& filename);
+
+		// Saves the elements to the file after a header, in large blocks.
+		// Defined in IO/Serialization.hpp, which callers have to include, look for: nstd::save
+		bool write_to_binary_file(const std::string& filename);
+
 		iterator begin() noexcept
 		{
 			return iterator(m_Head, m_Tail);
@@ -913,6 +1108,123 @@ class List
 		}
 
 	private:
+		// Returns the node at pos, walking from whichever end is closer
+		std::shared_ptr<ListNode> NodeAt(size_t pos) const
+		{
+			std::shared_ptr<ListNode> node;
+
+			if(pos < m_Size / 2)
+			{
+				node = m_Head;
+
+				while(pos--)
+					node = node->next;
+			}
+			else
+			{
+				node = m_Tail;
+
+				for(size_t i = m_Size - 1; i > pos; --i)
+					node = node->prev.lock();
+			}
+
+			return node;
+		}
+
+		// Links node in front of pos, or at the back if pos is null
+		void LinkBefore(std::shared_ptr<ListNode> pos, std::shared_ptr<ListNode> node)
+		{
+			LinkRangeBefore(std::move(pos), node, node, 1);
+		}
+
+		// Links the chain of count nodes from first to last in front of pos, or at the back if pos is null
+		void LinkRangeBefore(std::shared_ptr<ListNode> pos, std::shared_ptr<ListNode> first, std::shared_ptr<ListNode> last, size_t count)
+		{
+			std::shared_ptr<ListNode> prev = pos ? pos->prev.lock() : m_Tail;
+
+			first->prev = prev;
+			last->next	= pos;
+
+			if(prev)
+				prev->next = first;
+			else
+				m_Head = first;
+
+			if(pos)
+				pos->prev = last;
+			else
+				m_Tail = last;
+
+			m_Size += count;
+		}
+
+		// Detaches the count nodes from first to last, which keep their links between each other.
+		// Takes the nodes by value, so they stay alive while their neighbours drop them
+		void UnlinkRange(std::shared_ptr<ListNode> first, std::shared_ptr<ListNode> last, size_t count)
+		{
+			std::shared_ptr<ListNode> prev = first->prev.lock();
+			std::shared_ptr<ListNode> next = last->next;
+
+			if(prev)
+				prev->next = next;
+			else
+				m_Head = next;
+
+			if(next)
+				next->prev = prev;
+			else
+				m_Tail = prev;
+
+			last->next = nullptr;
+			m_Size -= count;
+		}
+
+		// Counts [first; last) if that doesn't consume it, returns 0 otherwise
+		template<typename InputIt>
+		static size_t KnownDistance(InputIt first, InputIt last)
+		{
+			if constexpr(std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+				return (size_t)std::distance(first, last);
+			else
+				return 0;
+		}
+
+		// Builds a node for each element of [first; last) and links it at the back. A chunk of the ChunkArena is
+		// only started for nodes that fill most of it: batches known to hold count elements take whole chunks and
+		// leave a smaller remainder to the heap, others only move to chunks once they filled one from the heap
+		template<typename InputIt>
+		void AppendNodes(InputIt first, InputIt last, size_t count)
+		{
+			size_t arenaNodes = ARENA_NODES ? count / ARENA_NODES * ARENA_NODES : 0;
+
+			if(ARENA_NODES && count - arenaNodes >= ARENA_NODES * 3 / 4)
+				arenaNodes = count;
+
+			nstd::ChunkArena arena;
+			nstd::ArenaAllocator<ListNode> allocator(arena);
+			size_t added = 0;
+
+			for(; first != last; ++first, ++added)
+			{
+				bool fromArena = added < arenaNodes || (count == 0 && ARENA_NODES && added >= ARENA_NODES);
+
+				std::shared_ptr<ListNode> node = fromArena
+					? std::allocate_shared<ListNode>(allocator, *first)
+					: std::make_shared<ListNode>(*first);
+
+				if(m_Size)
+				{
+					node->prev = m_Tail;
+					m_Tail->next = node;
+				}
+				else
+					m_Head = node;
+
+				m_Tail = std::move(node);
+				m_Size++;
+			}
+		}
+
 		std::shared_ptr<ListNode> Partition(std::shared_ptr<ListNode>& left, std::shared_ptr<ListNode>& right, const std::function<bool(const T&, const T&)>& comp)
 		{
 			T val = right->value;
@@ -946,8 +1258,12 @@ class List
 			}
 		}
 		
+		// Nodes per ChunkArena chunk. allocate_shared puts each node behind a control block of about three pointers,
+		// the allocator included
+		static constexpr size_t ARENA_NODES = nstd::ChunkArena::capacity(sizeof(ListNode) + 3 * sizeof(void*), alignof(ListNode));
+
 		std::shared_ptr<ListNode> m_Head;
 		std::shared_ptr<ListNode> m_Tail;
 
 		size_t m_Size = 0;
-};
+};
\ No newline at end of file
@@ -0,0 +1,309 @@
+#pragma once
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+#include "Vector.hpp"
+#include "Array.hpp"
+
+namespace nstd {
+	// Extent of a Span whose size is only known at runtime
+	inline constexpr size_t DYNAMIC_EXTENT = (size_t)-1;
+
+	template<typename T, size_t _Extent>
+	class Span;
+
+	namespace detail {
+		// Static extents don't need to store their size, Span derives from this to get the empty base optimization
+		template<size_t _Extent>
+		class SpanExtent {
+			public:
+				SpanExtent(size_t) { }
+
+				size_t Get() const {
+					return _Extent;
+				}
+		};
+
+		template<>
+		class SpanExtent<DYNAMIC_EXTENT> {
+			public:
+				SpanExtent(size_t uSize)
+					: m_uSize(uSize) { }
+
+				size_t Get() const {
+					return m_uSize;
+				}
+
+			private:
+				size_t m_uSize;
+		};
+
+		template<typename T>
+		struct IsSpan : std::false_type { };
+
+		template<typename T, size_t _Extent>
+		struct IsSpan<Span<T, _Extent>> : std::true_type { };
+
+		template<typename T>
+		struct IsArray : std::false_type { };
+
+		template<typename T, size_t _Size>
+		struct IsArray<Array<T, _Size>> : std::true_type { };
+
+		// Any container exposing contiguous storage through data() and size() whose elements can be viewed as T
+		template<typename Container, typename T, typename = void>
+		struct IsSpanCompatible : std::false_type { };
+
+		template<typename Container, typename T>
+		struct IsSpanCompatible<Container, T, std::void_t<decltype(std::declval<Container&>().data()), decltype(std::declval<Container&>().size())>>
+			: std::bool_constant<!IsSpan<std::remove_cv_t<Container>>::value
+							  && !IsArray<std::remove_cv_t<Container>>::value
+							  && std::is_convertible_v<std::remove_pointer_t<decltype(std::declval<Container&>().data())>(*)[], T(*)[]>> { };
+	}
+
+	// Non-owning view over _Extent contiguous elements, or over a runtime amount of them if _Extent is DYNAMIC_EXTENT.
+	// The viewed storage has to outlive the span
+	template<typename T, size_t _Extent = DYNAMIC_EXTENT>
+	class Span : private detail::SpanExtent<_Extent> {
+		private:
+			using Extent = detail::SpanExtent<_Extent>;
+
+		public:
+			using ValueType		= T;
+			using Iterator		= VectorIterator<Span<T, _Extent>>;
+			using ConstIterator = ConstVectorIterator<Span<T, _Extent>>;
+
+			static constexpr size_t extent = _Extent;
+
+		public:
+			// Empty span, only available for dynamic or zero extents
+			template<size_t _E = _Extent, std::enable_if_t<_E == DYNAMIC_EXTENT || _E == 0, int> = 0>
+			Span()
+				: Extent(0), m_pData(nullptr) { }
+
+			// Views uCount elements starting at pData. Throws if uCount doesn't match a static extent
+			Span(T* pData, size_t uCount)
+				: Extent(uCount), m_pData(pData) {
+				CheckExtent(uCount);
+			}
+
+			// Views the [pFirst; pLast) range. Throws if its length doesn't match a static extent.
+			// pLast is deduced, so that a literal 0 count picks the constructor above instead of being ambiguous
+			template<typename U, std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>, int> = 0>
+			Span(T* pFirst, U* pLast)
+				: Span(pFirst, (size_t)(pLast - pFirst)) { }
+
+			// Views a built-in array
+			template<typename U, size_t _Size, std::enable_if_t<(_Extent == DYNAMIC_EXTENT || _Extent == _Size) && std::is_convertible_v<U(*)[], T(*)[]>, int> = 0>
+			Span(U (&arr)[_Size])
+				: Extent(_Size), m_pData(arr) { }
+
+			// Views an nstd::Array
+			template<typename U, size_t _Size, std::enable_if_t<(_Extent == DYNAMIC_EXTENT || _Extent == _Size) && std::is_convertible_v<U(*)[], T(*)[]>, int> = 0>
+			Span(Array<U, _Size>& arr)
+				: Extent(_Size), m_pData(arr.data()) { }
+
+			template<typename U, size_t _Size, std::enable_if_t<(_Extent == DYNAMIC_EXTENT || _Extent == _Size) && std::is_convertible_v<const U(*)[], T(*)[]>, int> = 0>
+			Span(const Array<U, _Size>& arr)
+				: Extent(_Size), m_pData(arr.data()) { }
+
+			// Views any container with contiguous data() and size(): nstd::Vector, std::vector, std::array, std::string...
+			// Throws if its size doesn't match a static extent
+			template<typename Container, std::enable_if_t<detail::IsSpanCompatible<Container, T>::value, int> = 0>
+			Span(Container& container)
+				: Extent(container.size()), m_pData(container.data()) {
+				CheckExtent(container.size());
+			}
+
+			template<typename Container, std::enable_if_t<detail::IsSpanCompatible<const Container, T>::value, int> = 0>
+			Span(const Container& container)
+				: Extent(container.size()), m_pData(container.data()) {
+				CheckExtent(container.size());
+			}
+
+			// Converts between spans of compatible types, e.g. Span<int, 4> to Span<const int>
+			template<typename U, size_t _OtherExtent, std::enable_if_t<(_Extent == DYNAMIC_EXTENT || _OtherExtent == DYNAMIC_EXTENT || _Extent == _OtherExtent) && std::is_convertible_v<U(*)[], T(*)[]>, int> = 0>
+			Span(const Span<U, _OtherExtent>& other)
+				: Extent(other.size()), m_pData(other.data()) {
+				CheckExtent(other.size());
+			}
+
+			Span(const Span& other) = default;
+			Span& operator =(const Span& other) = default;
+
+			// Accesses m_pData[uIndex] and returns a reference. If uIndex is invalid, throws an exception
+			T& at(size_t uIndex) const {
+				if (uIndex >= size())
+					throw std::out_of_range("Invalid index");
+
+				return m_pData[uIndex];
+			}
+
+			// Accesses m_pData[uIndex] and returns a reference
+			T& operator [](size_t uIndex) const {
+				return m_pData[uIndex];
+			}
+
+			// Returns a reference to the first element. If there are no elements, throws an exception
+			T& front() const {
+				if (empty())
+					throw std::out_of_range("No elements in the span");
+
+				return m_pData[0];
+			}
+
+			// Returns a reference to the last element. If there are no elements, throws an exception
+			T& back() const {
+				if (empty())
+					throw std::out_of_range("No elements in the span");
+
+				return m_pData[size() - 1];
+			}
+
+			// Returns the pointer to the first viewed element
+			T* data() const {
+				return m_pData;
+			}
+
+			// Returns the number of viewed elements
+			size_t size() const {
+				return Extent::Get();
+			}
+
+			// Returns the number of viewed bytes
+			size_t size_bytes() const {
+				return size() * sizeof(T);
+			}
+
+			// Returns true if this span views no elements, false otherwise
+			bool empty() const {
+				return size() == 0;
+			}
+
+			Iterator begin() const {
+				return Iterator(m_pData);
+			}
+
+			Iterator end() const {
+				return Iterator(m_pData + size());
+			}
+
+			ConstIterator cbegin() const {
+				return ConstIterator(m_pData);
+			}
+
+			ConstIterator cend() const {
+				return ConstIterator(m_pData + size());
+			}
+
+			// Returns a span over the first _Count elements
+			template<size_t _Count>
+			Span<T, _Count> first() const {
+				static_assert(_Extent == DYNAMIC_EXTENT || _Count <= _Extent, "Count exceeds the extent of the span");
+				CheckRange(0, _Count);
+
+				return Span<T, _Count>(m_pData, _Count);
+			}
+
+			// Returns a span over the first uCount elements. Throws if there are less than uCount elements
+			Span<T> first(size_t uCount) const {
+				CheckRange(0, uCount);
+
+				return Span<T>(m_pData, uCount);
+			}
+
+			// Returns a span over the last _Count elements
+			template<size_t _Count>
+			Span<T, _Count> last() const {
+				static_assert(_Extent == DYNAMIC_EXTENT || _Count <= _Extent, "Count exceeds the extent of the span");
+				CheckRange(0, _Count);
+
+				return Span<T, _Count>(m_pData + size() - _Count, _Count);
+			}
+
+			// Returns a span over the last uCount elements. Throws if there are less than uCount elements
+			Span<T> last(size_t uCount) const {
+				CheckRange(0, uCount);
+
+				return Span<T>(m_pData + size() - uCount, uCount);
+			}
+
+			// Returns a span over _Count elements starting at _Offset, or over everything past _Offset if _Count is DYNAMIC_EXTENT
+			template<size_t _Offset, size_t _Count = DYNAMIC_EXTENT>
+			auto subspan() const {
+				static_assert(_Extent == DYNAMIC_EXTENT || _Offset <= _Extent, "Offset exceeds the extent of the span");
+				static_assert(_Extent == DYNAMIC_EXTENT || _Count == DYNAMIC_EXTENT || _Offset + _Count <= _Extent, "Subspan exceeds the extent of the span");
+
+				constexpr size_t _NewExtent = _Count != DYNAMIC_EXTENT ? _Count : (_Extent != DYNAMIC_EXTENT ? _Extent - _Offset : DYNAMIC_EXTENT);
+
+				size_t uCount = _Count != DYNAMIC_EXTENT ? _Count : size() - _Offset;
+
+				CheckRange(_Offset, uCount);
+
+				return Span<T, _NewExtent>(m_pData + _Offset, uCount);
+			}
+
+			// Returns a span over uCount elements starting at uOffset, or over everything past uOffset if uCount is DYNAMIC_EXTENT.
+			// Throws if the subspan doesn't fit in this one
+			Span<T> subspan(size_t uOffset, size_t uCount = DYNAMIC_EXTENT) const {
+				if (uOffset > size())
+					throw std::out_of_range("Offset exceeds the size of the span");
+
+				if (uCount == DYNAMIC_EXTENT)
+					uCount = size() - uOffset;
+
+				CheckRange(uOffset, uCount);
+
+				return Span<T>(m_pData + uOffset, uCount);
+			}
+
+		private:
+			void CheckExtent(size_t uCount) const {
+				if (_Extent != DYNAMIC_EXTENT && uCount != _Extent)
+					throw std::out_of_range("Size doesn't match the extent of the span");
+			}
+
+			void CheckRange(size_t uOffset, size_t uCount) const {
+				if (uOffset > size() || uCount > size() - uOffset)
+					throw std::out_of_range("Subspan exceeds the size of the span");
+			}
+
+		private:
+			T* m_pData;
+	};
+
+	template<typename T, size_t _Size>
+	Span(T (&)[_Size]) -> Span<T, _Size>;
+
+	template<typename T, size_t _Size>
+	Span(Array<T, _Size>&) -> Span<T, _Size>;
+
+	template<typename T, size_t _Size>
+	Span(const Array<T, _Size>&) -> Span<const T, _Size>;
+
+	template<typename T>
+	Span(T*, size_t) -> Span<T>;
+
+	template<typename T>
+	Span(T*, T*) -> Span<T>;
+
+	template<typename Container>
+	Span(Container&) -> Span<std::remove_pointer_t<decltype(std::declval<Container&>().data())>>;
+
+	template<typename Container>
+	Span(const Container&) -> Span<std::remove_pointer_t<decltype(std::declval<const Container&>().data())>>;
+
+	// Views the object representation of the span's elements
+	template<typename T, size_t _Extent>
+	Span<const std::byte, _Extent == DYNAMIC_EXTENT ? DYNAMIC_EXTENT : _Extent * sizeof(T)> as_bytes(Span<T, _Extent> span) {
+		return { reinterpret_cast<const std::byte*>(span.data()), span.size_bytes() };
+	}
+
+	// Views the object representation of the span's elements as writable bytes
+	template<typename T, size_t _Extent, std::enable_if_t<!std::is_const_v<T>, int> = 0>
+	Span<std::byte, _Extent == DYNAMIC_EXTENT ? DYNAMIC_EXTENT : _Extent * sizeof(T)> as_writable_bytes(Span<T, _Extent> span) {
+		return { reinterpret_cast<std::byte*>(span.data()), span.size_bytes() };
+	}
+}
\ No newline at end of file
@@ -0,0 +1,226 @@
+#pragma once
+
+#include <bit>
+#include <new>
+#include <limits>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <functional>
+
+#include "Span.hpp"
+#include "Vector.hpp"
+#include "../Memory/Memory.hpp"
+
+namespace nstd {
+	// Read-only search structure over a sorted sequence, answering lower_bound/upper_bound queries with the rank
+	// of the result in the original sequence.
+	// The keys are copied in Eytzinger order (the breadth-first layout of an implicit binary search tree, node k
+	// having children 2k and 2k + 1), so the first levels of every search share a few hot cache lines and the
+	// descendants 4 levels below a node are contiguous. Each step prefetches them while the current comparison
+	// resolves, and the comparison only selects the next node, so the descent neither stalls on misses nor mispredicts.
+	// Ranks are stored as RankType to keep the extra array small, construction throws if they don't fit
+	template<typename T, typename Compare = std::less<T>, typename RankType = uint32_t>
+	class StaticSearchIndex {
+		public:
+			using ValueType = T;
+
+		public:
+			StaticSearchIndex() = default;
+
+			// Builds the index from keys sorted by comp. Duplicates are allowed, lower_bound finds the first of them
+			explicit StaticSearchIndex(Span<const T> sorted, const Compare& comp = Compare{})
+				: m_Compare(comp) {
+				if (sorted.size() > (size_t)std::numeric_limits<RankType>::max())
+					throw std::out_of_range("Too many keys for the rank type");
+
+				m_uSize = sorted.size();
+				m_pTree = Allocate(m_uSize);
+				m_Ranks.resize(m_uSize + 1, std::numeric_limits<RankType>::max());
+
+				size_t uNext = 0;
+
+				try {
+					Build(sorted, 1, uNext);
+				}
+				catch (...) {
+					// Only the nodes given a rank were constructed
+					for (size_t k = 1; k <= m_uSize; ++k)
+						if (m_Ranks[k] < uNext)
+							m_pTree[k].~T();
+
+					Deallocate();
+
+					throw;
+				}
+			}
+
+			StaticSearchIndex(const StaticSearchIndex& other) {
+				*this = other;
+			}
+
+			StaticSearchIndex(StaticSearchIndex&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			~StaticSearchIndex() {
+				Free();
+			}
+
+			StaticSearchIndex& operator =(const StaticSearchIndex& other) {
+				if (this == &other)
+					return *this;
+
+				Free();
+
+				m_pTree = Allocate(other.m_uSize);
+
+				for (size_t k = 1; k <= other.m_uSize; ++k) {
+					try {
+						new(m_pTree + k) T(other.m_pTree[k]);
+					}
+					catch (...) {
+						while (--k > 0)
+							m_pTree[k].~T();
+
+						Deallocate();
+
+						throw;
+					}
+				}
+
+				m_uSize	  = other.m_uSize;
+				m_Ranks	  = other.m_Ranks;
+				m_Compare = other.m_Compare;
+
+				return *this;
+			}
+
+			StaticSearchIndex& operator =(StaticSearchIndex&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				Free();
+
+				m_pTree	  = other.m_pTree;
+				m_uSize	  = other.m_uSize;
+				m_Ranks	  = std::move(other.m_Ranks);
+				m_Compare = std::move(other.m_Compare);
+
+				other.m_pTree = nullptr;
+				other.m_uSize = 0;
+
+				return *this;
+			}
+
+			// Returns the rank of the first key that isn't ordered before key, or size() if there is none
+			template<typename Key>
+			size_t lower_bound(const Key& key) const {
+				size_t k = 1;
+
+				while (k <= m_uSize) {
+					PrefetchDescendants(k);
+					k = 2 * k + (m_Compare(m_pTree[k], key) ? 1 : 0);
+				}
+
+				return RankOf(k);
+			}
+
+			// Returns the rank of the first key that is ordered after key, or size() if there is none
+			template<typename Key>
+			size_t upper_bound(const Key& key) const {
+				size_t k = 1;
+
+				while (k <= m_uSize) {
+					PrefetchDescendants(k);
+					k = 2 * k + (m_Compare(key, m_pTree[k]) ? 0 : 1);
+				}
+
+				return RankOf(k);
+			}
+
+			// Returns true if a key equivalent to key was indexed, false otherwise
+			template<typename Key>
+			bool contains(const Key& key) const {
+				size_t k = 1;
+
+				while (k <= m_uSize) {
+					PrefetchDescendants(k);
+					k = 2 * k + (m_Compare(m_pTree[k], key) ? 1 : 0);
+				}
+
+				k >>= std::countr_one(k) + 1;
+
+				return k != 0 && !m_Compare(key, m_pTree[k]);
+			}
+
+			// Returns the number of indexed keys
+			size_t size() const {
+				return m_uSize;
+			}
+
+			bool empty() const {
+				return m_uSize == 0;
+			}
+
+		private:
+			// Number of keys in a cache line: the descendants of node k at that depth start at node k * KEYS_PER_LINE
+			static constexpr size_t KEYS_PER_LINE = sizeof(T) < CACHE_LINE_SIZE ? std::bit_floor(CACHE_LINE_SIZE / sizeof(T)) : 1;
+
+			// The tree is 1-based, so slot 0 stays raw. Aligning the block to a cache line makes every group of
+			// KEYS_PER_LINE descendants share a single line
+			static T* Allocate(size_t uSize) {
+				return static_cast<T*>(::operator new((uSize + 1) * sizeof(T), std::align_val_t(CACHE_LINE_SIZE)));
+			}
+
+			// In-order traversal of the implicit tree, hands out the sorted keys in ascending order
+			void Build(Span<const T> sorted, size_t k, size_t& uNext) {
+				if (k > m_uSize)
+					return;
+
+				Build(sorted, 2 * k, uNext);
+
+				new(m_pTree + k) T(sorted[uNext]);
+				m_Ranks[k] = (RankType)uNext;
+				uNext++;
+
+				Build(sorted, 2 * k + 1, uNext);
+			}
+
+			void PrefetchDescendants(size_t k) const {
+				prefetch(reinterpret_cast<const void*>(reinterpret_cast<uintptr_t>(m_pTree) + k * KEYS_PER_LINE * sizeof(T)));
+			}
+
+			// The search ends below a leaf after turning right at every node past the answer,
+			// so dropping those trailing right turns plus one left turn leads back to it
+			size_t RankOf(size_t k) const {
+				k >>= std::countr_one(k) + 1;
+
+				return k == 0 ? m_uSize : (size_t)m_Ranks[k];
+			}
+
+			void Deallocate() {
+				::operator delete(m_pTree, std::align_val_t(CACHE_LINE_SIZE));
+
+				m_pTree = nullptr;
+				m_uSize = 0;
+			}
+
+			void Free() {
+				if (!m_pTree)
+					return;
+
+				for (size_t k = 1; k <= m_uSize; ++k)
+					m_pTree[k].~T();
+
+				Deallocate();
+			}
+
+		private:
+			T*				 m_pTree = nullptr;
+			size_t			 m_uSize = 0;
+			Vector<RankType> m_Ranks;
+			Compare			 m_Compare;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,610 @@
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <initializer_list>
+
+#include "../Memory/Allocator.hpp"
+
+namespace nstd {
+	namespace detail {
+		// Bytes of elements an UnrolledList node holds by default
+		constexpr size_t UNROLLED_NODE_BYTES = 256;
+
+		// Doubly linked node holding up to _Capacity elements, the first uCount of them constructed
+		template<typename T, size_t _Capacity>
+		struct UnrolledNode {
+			UnrolledNode* pPrev	 = nullptr;
+			UnrolledNode* pNext	 = nullptr;
+			size_t		  uCount = 0;
+
+			alignas(T) unsigned char Storage[_Capacity * sizeof(T)];
+
+			T* Data() {
+				return std::launder(reinterpret_cast<T*>(Storage));
+			}
+		};
+	}
+
+	template<typename List, bool bConst>
+	class UnrolledListIterator {
+		public:
+			using ValueType = std::conditional_t<bConst, const typename List::ValueType, typename List::ValueType>;
+
+			using iterator_concept	= std::bidirectional_iterator_tag;
+			using iterator_category = std::bidirectional_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= typename List::ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
+		private:
+			using NodeType = typename List::NodeType;
+
+		public:
+			UnrolledListIterator() = default;
+
+			UnrolledListIterator(NodeType* pNode, size_t uIndex)
+				: m_pNode(pNode), m_uIndex(uIndex) { }
+
+			// Every iterator converts to its const counterpart
+			template<bool bOtherConst, std::enable_if_t<bConst && !bOtherConst, int> = 0>
+			UnrolledListIterator(const UnrolledListIterator<List, bOtherConst>& other)
+				: m_pNode(other.m_pNode), m_uIndex(other.m_uIndex) { }
+
+			// Past the last element of a node moves to the next one, except for the last node where it is the end
+			UnrolledListIterator& operator ++() {
+				if (++m_uIndex == m_pNode->uCount && m_pNode->pNext) {
+					m_pNode	 = m_pNode->pNext;
+					m_uIndex = 0;
+				}
+
+				return *this;
+			}
+
+			UnrolledListIterator operator ++(int) {
+				UnrolledListIterator itr = *this;
+
+				++(*this);
+
+				return itr;
+			}
+
+			UnrolledListIterator& operator --() {
+				if (m_uIndex == 0) {
+					m_pNode	 = m_pNode->pPrev;
+					m_uIndex = m_pNode->uCount;
+				}
+
+				--m_uIndex;
+
+				return *this;
+			}
+
+			UnrolledListIterator operator --(int) {
+				UnrolledListIterator itr = *this;
+
+				--(*this);
+
+				return itr;
+			}
+
+			ValueType* operator ->() const {
+				return m_pNode->Data() + m_uIndex;
+			}
+
+			ValueType& operator *() const {
+				return m_pNode->Data()[m_uIndex];
+			}
+
+			bool operator ==(const UnrolledListIterator& other) const {
+				return m_pNode == other.m_pNode && m_uIndex == other.m_uIndex;
+			}
+
+			bool operator !=(const UnrolledListIterator& other) const {
+				return !(*this == other);
+			}
+
+		private:
+			template<typename, bool>
+			friend class UnrolledListIterator;
+
+			template<typename, size_t, typename>
+			friend class UnrolledList;
+
+		private:
+			NodeType* m_pNode  = nullptr;
+			size_t	  m_uIndex = 0;
+	};
+
+	// Doubly linked list of small blocks of elements. Traversal walks contiguous elements and only follows a link
+	// every _NodeCapacity of them, while inserting or erasing in the middle only shifts the elements of one node.
+	// A full node splits in two on insertion, and erasing merges a node into a neighbour once both fit in three
+	// quarters of a node, which keeps sparse nodes from piling up without thrashing between split and merge.
+	// Inserting and erasing invalidate iterators to the elements of the nodes involved
+	template<typename T, size_t _NodeCapacity = std::max<size_t>(detail::UNROLLED_NODE_BYTES / sizeof(T), 4), typename Alloc = Allocator<T>>
+	class UnrolledList {
+		static_assert(_NodeCapacity >= 2, "Nodes have to hold at least two elements");
+
+		public:
+			using ValueType		= T;
+			using NodeType		= detail::UnrolledNode<T, _NodeCapacity>;
+			using Iterator		= UnrolledListIterator<UnrolledList, false>;
+			using ConstIterator = UnrolledListIterator<UnrolledList, true>;
+
+			using value_type	 = T;
+			using size_type		 = size_t;
+			using iterator		 = Iterator;
+			using const_iterator = ConstIterator;
+
+			static constexpr size_t NODE_CAPACITY = _NodeCapacity;
+
+		private:
+			using NodeAllocator = typename Alloc::template rebind<NodeType>::other;
+
+			// Neighbours are merged once their elements fit in this many slots
+			static constexpr size_t MERGE_THRESHOLD = _NodeCapacity - _NodeCapacity / 4;
+
+		public:
+			UnrolledList() = default;
+
+			// Constructs uCount copies of value
+			UnrolledList(size_t uCount, const T& value) {
+				for (size_t i = 0; i < uCount; ++i)
+					push_back(value);
+			}
+
+			template<typename InputItr, typename = typename std::iterator_traits<InputItr>::iterator_category>
+			UnrolledList(InputItr first, InputItr last) {
+				for (; first != last; ++first)
+					emplace_back(*first);
+			}
+
+			UnrolledList(std::initializer_list<T> list)
+				: UnrolledList(list.begin(), list.end()) { }
+
+			UnrolledList(const UnrolledList& other)
+				: UnrolledList(other.begin(), other.end()) { }
+
+			UnrolledList(UnrolledList&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			~UnrolledList() {
+				clear();
+			}
+
+			// Clears the current list, copies every element of the other one
+			UnrolledList& operator =(const UnrolledList& other) {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				for (const T& value : other)
+					push_back(value);
+
+				return *this;
+			}
+
+			// Clears the current list, steals the nodes of the other one and leaves it empty
+			UnrolledList& operator =(UnrolledList&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				clear();
+
+				m_pHead = other.m_pHead;
+				m_pTail = other.m_pTail;
+				m_uSize = other.m_uSize;
+
+				other.m_pHead = nullptr;
+				other.m_pTail = nullptr;
+				other.m_uSize = 0;
+
+				return *this;
+			}
+
+			// Accesses the element at uIndex, skipping whole nodes from the closer end. If uIndex is invalid, throws an exception
+			T& at(size_t uIndex) {
+				if (uIndex >= m_uSize)
+					throw std::out_of_range("Invalid index");
+
+				Iterator itr = Locate(uIndex);
+
+				return *itr;
+			}
+
+			const T& at(size_t uIndex) const {
+				return const_cast<UnrolledList*>(this)->at(uIndex);
+			}
+
+			// Returns a reference to the first element. If there are no elements, throws an exception
+			T& front() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return m_pHead->Data()[0];
+			}
+
+			const T& front() const {
+				return const_cast<UnrolledList*>(this)->front();
+			}
+
+			// Returns a reference to the last element. If there are no elements, throws an exception
+			T& back() {
+				if (m_uSize == 0)
+					throw std::out_of_range("No elements in the container");
+
+				return m_pTail->Data()[m_pTail->uCount - 1];
+			}
+
+			const T& back() const {
+				return const_cast<UnrolledList*>(this)->back();
+			}
+
+			void push_back(const T& value) {
+				emplace_back(value);
+			}
+
+			void push_back(T&& value) {
+				emplace_back(std::move(value));
+			}
+
+			template<typename... Args>
+			T& emplace_back(Args&&... args) {
+				return *emplace(cend(), std::forward<Args>(args)...);
+			}
+
+			void push_front(const T& value) {
+				emplace_front(value);
+			}
+
+			void push_front(T&& value) {
+				emplace_front(std::move(value));
+			}
+
+			template<typename... Args>
+			T& emplace_front(Args&&... args) {
+				return *emplace(cbegin(), std::forward<Args>(args)...);
+			}
+
+			Iterator insert(ConstIterator pos, const T& value) {
+				return emplace(pos, value);
+			}
+
+			Iterator insert(ConstIterator pos, T&& value) {
+				return emplace(pos, std::move(value));
+			}
+
+			// Constructs a T instance with given arguments in front of pos and returns an iterator to it.
+			// At a full node, an insertion at either of its ends goes to a neighbour with room or a new node,
+			// anywhere else the node splits in half first
+			template<typename... Args>
+			Iterator emplace(ConstIterator pos, Args&&... args) {
+				NodeType* pNode	 = pos.m_pNode;
+				size_t	  uIndex = pos.m_uIndex;
+
+				if (!pNode) {
+					pNode = NewNode(nullptr, nullptr, std::forward<Args>(args)...);
+					m_uSize++;
+
+					return Iterator(pNode, 0);
+				}
+
+				if (pNode->uCount == _NodeCapacity) {
+					if (uIndex == _NodeCapacity) {
+						if (!pNode->pNext || pNode->pNext->uCount == _NodeCapacity) {
+							pNode = NewNode(pNode, pNode->pNext, std::forward<Args>(args)...);
+							m_uSize++;
+
+							return Iterator(pNode, 0);
+						}
+
+						pNode  = pNode->pNext;
+						uIndex = 0;
+					}
+					else if (uIndex == 0) {
+						if (!pNode->pPrev || pNode->pPrev->uCount == _NodeCapacity) {
+							pNode = NewNode(pNode->pPrev, pNode, std::forward<Args>(args)...);
+							m_uSize++;
+
+							return Iterator(pNode, 0);
+						}
+
+						pNode  = pNode->pPrev;
+						uIndex = pNode->uCount;
+					}
+					else {
+						// args may refer to an element the split moves
+						T value(std::forward<Args>(args)...);
+						NodeType* pUpper = Split(pNode);
+
+						if (uIndex > pNode->uCount) {
+							uIndex -= pNode->uCount;
+							pNode	= pUpper;
+						}
+
+						InsertInNode(pNode, uIndex, std::move(value));
+						m_uSize++;
+
+						return Iterator(pNode, uIndex);
+					}
+				}
+
+				InsertInNode(pNode, uIndex, std::forward<Args>(args)...);
+				m_uSize++;
+
+				return Iterator(pNode, uIndex);
+			}
+
+			// Destroys the element at pos and returns an iterator to the one after it
+			Iterator erase(ConstIterator pos) {
+				NodeType* pNode	 = pos.m_pNode;
+				size_t	  uIndex = pos.m_uIndex;
+
+				EraseInNode(pNode, uIndex);
+				m_uSize--;
+
+				if (pNode->uCount == 0) {
+					NodeType* pNext = pNode->pNext;
+
+					FreeNode(pNode);
+
+					return pNext ? Iterator(pNext, 0) : end();
+				}
+
+				if (pNode->pPrev && pNode->pPrev->uCount + pNode->uCount <= MERGE_THRESHOLD) {
+					uIndex += pNode->pPrev->uCount;
+					pNode	= pNode->pPrev;
+
+					MergeNext(pNode);
+				}
+
+				if (pNode->pNext && pNode->uCount + pNode->pNext->uCount <= MERGE_THRESHOLD)
+					MergeNext(pNode);
+
+				if (uIndex == pNode->uCount && pNode->pNext)
+					return Iterator(pNode->pNext, 0);
+
+				return Iterator(pNode, uIndex);
+			}
+
+			// Destroys the elements in [first; last) and returns an iterator to the one after them
+			Iterator erase(ConstIterator first, ConstIterator last) {
+				size_t uCount = (size_t)std::distance(first, last);
+				Iterator itr  = Iterator(first.m_pNode, first.m_uIndex);
+
+				// Merging moves elements between nodes, so last can't be compared against along the way
+				while (uCount--)
+					itr = erase(itr);
+
+				return itr;
+			}
+
+			// If there are any elements, destroys the last one
+			void pop_back() {
+				if (m_uSize == 0)
+					return;
+
+				erase(Iterator(m_pTail, m_pTail->uCount - 1));
+			}
+
+			// If there are any elements, destroys the first one
+			void pop_front() {
+				if (m_uSize == 0)
+					return;
+
+				erase(begin());
+			}
+
+			// Destroys every element and frees every node
+			void clear() {
+				while (m_pHead) {
+					NodeType* pNext = m_pHead->pNext;
+					T*		  pData = m_pHead->Data();
+
+					for (size_t i = 0; i < m_pHead->uCount; ++i)
+						pData[i].~T();
+
+					m_Allocator.deallocate(m_pHead, 1);
+					m_pHead = pNext;
+				}
+
+				m_pTail = nullptr;
+				m_uSize = 0;
+			}
+
+			void swap(UnrolledList& other) noexcept {
+				std::swap(m_pHead, other.m_pHead);
+				std::swap(m_pTail, other.m_pTail);
+				std::swap(m_uSize, other.m_uSize);
+			}
+
+			bool empty() const {
+				return m_uSize == 0;
+			}
+
+			size_t size() const {
+				return m_uSize;
+			}
+
+			Iterator begin() {
+				return Iterator(m_pHead, 0);
+			}
+
+			Iterator end() {
+				return m_pTail ? Iterator(m_pTail, m_pTail->uCount) : Iterator();
+			}
+
+			ConstIterator begin() const {
+				return const_cast<UnrolledList*>(this)->begin();
+			}
+
+			ConstIterator end() const {
+				return const_cast<UnrolledList*>(this)->end();
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+		private:
+			Iterator Locate(size_t uIndex) {
+				if (uIndex < m_uSize / 2) {
+					NodeType* pNode = m_pHead;
+
+					while (uIndex >= pNode->uCount) {
+						uIndex -= pNode->uCount;
+						pNode	= pNode->pNext;
+					}
+
+					return Iterator(pNode, uIndex);
+				}
+
+				NodeType* pNode	 = m_pTail;
+				size_t	  uAfter = m_uSize - 1 - uIndex;
+
+				while (uAfter >= pNode->uCount) {
+					uAfter -= pNode->uCount;
+					pNode	= pNode->pPrev;
+				}
+
+				return Iterator(pNode, pNode->uCount - 1 - uAfter);
+			}
+
+			// Allocates a node holding T(args...) and links it between pPrev and pNext
+			template<typename... Args>
+			NodeType* NewNode(NodeType* pPrev, NodeType* pNext, Args&&... args) {
+				NodeType* pNode = m_Allocator.allocate(1);
+
+				new(pNode) NodeType;
+
+				try {
+					new(pNode->Data()) T(std::forward<Args>(args)...);
+				}
+				catch (...) {
+					m_Allocator.deallocate(pNode, 1);
+
+					throw;
+				}
+
+				pNode->uCount = 1;
+				Link(pNode, pPrev, pNext);
+
+				return pNode;
+			}
+
+			void Link(NodeType* pNode, NodeType* pPrev, NodeType* pNext) {
+				pNode->pPrev = pPrev;
+				pNode->pNext = pNext;
+
+				if (pPrev)
+					pPrev->pNext = pNode;
+				else
+					m_pHead = pNode;
+
+				if (pNext)
+					pNext->pPrev = pNode;
+				else
+					m_pTail = pNode;
+			}
+
+			// Unlinks and deallocates a node whose elements are already destroyed or moved out
+			void FreeNode(NodeType* pNode) {
+				if (pNode->pPrev)
+					pNode->pPrev->pNext = pNode->pNext;
+				else
+					m_pHead = pNode->pNext;
+
+				if (pNode->pNext)
+					pNode->pNext->pPrev = pNode->pPrev;
+				else
+					m_pTail = pNode->pPrev;
+
+				m_Allocator.deallocate(pNode, 1);
+			}
+
+			// Shifts the elements from uIndex on one slot up and constructs the new one in the gap.
+			// The value is built first, args may refer to an element about to move
+			template<typename... Args>
+			static void InsertInNode(NodeType* pNode, size_t uIndex, Args&&... args) {
+				T*	   pData  = pNode->Data();
+				size_t uCount = pNode->uCount;
+
+				if (uIndex == uCount) {
+					new(pData + uCount) T(std::forward<Args>(args)...);
+				}
+				else {
+					T value(std::forward<Args>(args)...);
+
+					new(pData + uCount) T(std::move(pData[uCount - 1]));
+					std::move_backward(pData + uIndex, pData + uCount - 1, pData + uCount);
+					pData[uIndex] = std::move(value);
+				}
+
+				pNode->uCount++;
+			}
+
+			static void EraseInNode(NodeType* pNode, size_t uIndex) {
+				T* pData = pNode->Data();
+
+				std::move(pData + uIndex + 1, pData + pNode->uCount, pData + uIndex);
+				pData[--pNode->uCount].~T();
+			}
+
+			// Moves the upper half of a full node into a new node linked after it, and returns the new node
+			NodeType* Split(NodeType* pNode) {
+				NodeType* pUpper = m_Allocator.allocate(1);
+
+				new(pUpper) NodeType;
+
+				size_t uKeep = pNode->uCount / 2;
+				T*	   pFrom = pNode->Data();
+				T*	   pTo	 = pUpper->Data();
+
+				for (size_t i = uKeep; i < pNode->uCount; ++i) {
+					new(pTo + i - uKeep) T(std::move(pFrom[i]));
+					pFrom[i].~T();
+				}
+
+				pUpper->uCount = pNode->uCount - uKeep;
+				pNode->uCount  = uKeep;
+
+				Link(pUpper, pNode, pNode->pNext);
+
+				return pUpper;
+			}
+
+			// Moves every element of the node after pNode to its end and frees that node
+			void MergeNext(NodeType* pNode) {
+				NodeType* pNext = pNode->pNext;
+				T*		  pFrom = pNext->Data();
+				T*		  pTo	= pNode->Data() + pNode->uCount;
+
+				for (size_t i = 0; i < pNext->uCount; ++i) {
+					new(pTo + i) T(std::move(pFrom[i]));
+					pFrom[i].~T();
+				}
+
+				pNode->uCount += pNext->uCount;
+
+				FreeNode(pNext);
+			}
+
+		private:
+			NodeType*	  m_pHead = nullptr;
+			NodeType*	  m_pTail = nullptr;
+			size_t		  m_uSize = 0;
+			NodeAllocator m_Allocator;
+	};
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 #include <initializer_list>
 
 #include "../Memory/Allocator.hpp"
@@ -11,7 +14,17 @@ namespace nstd {
 		public:
 			using ValueType = typename Vector::ValueType;
 
+			using iterator_concept	= std::contiguous_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= std::remove_cv_t<ValueType>;
+			using element_type		= ValueType;
+			using pointer			= ValueType*;
+			using reference			= ValueType&;
+
 		public:
+			VectorIterator() = default;
+
 			VectorIterator(ValueType* ptr)
 				: m_Ptr(ptr) { }
 
@@ -20,7 +33,7 @@ namespace nstd {
 
 				return *this;
 			}
-			
+
 			VectorIterator operator ++(int) {
 				VectorIterator itr = *this;
 
@@ -43,84 +56,72 @@ namespace nstd {
 				return itr;
 			}
 
-			ValueType& operator [](size_t uIndex) {
-				return *(m_Ptr + uIndex);
+			ValueType& operator [](difference_type iIndex) const {
+				return *(m_Ptr + iIndex);
 			}
 
-			ValueType* operator ->() {
+			ValueType* operator ->() const {
 				return m_Ptr;
 			}
 
-			ValueType& operator *() {
+			ValueType& operator *() const {
 				return *m_Ptr;
 			}
 
-			size_t operator +(const VectorIterator& other) {
-				return m_Ptr + other;
-			}
-
-			size_t operator -(const VectorIterator& other) {
+			difference_type operator -(const VectorIterator& other) const {
 				return m_Ptr - other.m_Ptr;
 			}
 
-			VectorIterator operator +(size_t uOffset) {
-				return VectorIterator(m_Ptr + uOffset);
+			VectorIterator operator +(difference_type iOffset) const {
+				return VectorIterator(m_Ptr + iOffset);
 			}
 
-			VectorIterator operator -(size_t uOffset) {
-				return VectorIterator(m_Ptr - uOffset);
+			VectorIterator operator -(difference_type iOffset) const {
+				return VectorIterator(m_Ptr - iOffset);
 			}
 
-			VectorIterator& operator +=(const VectorIterator& other) {
-				m_Ptr += other.m_Ptr;
+			VectorIterator& operator +=(difference_type iOffset) {
+				m_Ptr += iOffset;
 
 				return *this;
 			}
 
-			VectorIterator& operator -=(const VectorIterator& other) {
-				m_Ptr -= other.m_Ptr;
+			VectorIterator& operator -=(difference_type iOffset) {
+				m_Ptr -= iOffset;
 
 				return *this;
 			}
 
-			VectorIterator& operator +=(size_t uOffset) {
-				m_Ptr += uOffset;
-
-				return *this;
-			}
-
-			VectorIterator& operator -=(size_t uOffset) {
-				m_Ptr -= uOffset;
-
-				return *this;
-			}
-
-			bool operator ==(const VectorIterator& other) {
+			bool operator ==(const VectorIterator& other) const {
 				return m_Ptr == other.m_Ptr;
 			}
 
-			bool operator !=(const VectorIterator& other) {
+			bool operator !=(const VectorIterator& other) const {
 				return m_Ptr != other.m_Ptr;
 			}
 
-			bool operator <(const VectorIterator& other) {
+			bool operator <(const VectorIterator& other) const {
 				return m_Ptr < other.m_Ptr;
 			}
 
-			bool operator <=(const VectorIterator& other) {
+			bool operator <=(const VectorIterator& other) const {
 				return m_Ptr <= other.m_Ptr;
 			}
 
-			bool operator >(const VectorIterator& other) {
+			bool operator >(const VectorIterator& other) const {
 				return m_Ptr > other.m_Ptr;
 			}
 
-			bool operator >=(const VectorIterator& other) {
+			bool operator >=(const VectorIterator& other) const {
 				return m_Ptr >= other.m_Ptr;
 			}
 
+			friend VectorIterator operator +(difference_type iOffset, const VectorIterator& itr) {
+				return itr + iOffset;
+			}
+
 		private:
-			ValueType* m_Ptr;
+			ValueType* m_Ptr = nullptr;
 	};
 
 	template<typename Vector>
@@ -128,10 +129,24 @@ namespace nstd {
 		public:
 			using ValueType = typename Vector::ValueType;
 
+			using iterator_concept	= std::contiguous_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
+			using difference_type	= ptrdiff_t;
+			using value_type		= std::remove_cv_t<ValueType>;
+			using element_type		= const ValueType;
+			using pointer			= const ValueType*;
+			using reference			= const ValueType&;
+
 		public:
-			ConstVectorIterator(ValueType* ptr)
+			ConstVectorIterator() = default;
+
+			ConstVectorIterator(const ValueType* ptr)
 				: m_Ptr(ptr) { }
 
+			//Every iterator converts to its const counterpart
+			ConstVectorIterator(const VectorIterator<Vector>& itr)
+				: m_Ptr(itr.operator ->()) { }
+
 			ConstVectorIterator& operator ++() {
 				m_Ptr++;
 
@@ -160,8 +175,8 @@ namespace nstd {
 				return itr;
 			}
 
-			const ValueType& operator [](size_t uIndex) const {
-				return *(m_Ptr + uIndex);
+			const ValueType& operator [](difference_type iIndex) const {
+				return *(m_Ptr + iIndex);
 			}
 
 			const ValueType* operator ->() const {
@@ -172,72 +187,60 @@ namespace nstd {
 				return *m_Ptr;
 			}
 
-			size_t operator +(const ConstVectorIterator& other) {
-				return m_Ptr + other;
-			}
-
-			size_t operator -(const ConstVectorIterator& other) {
+			difference_type operator -(const ConstVectorIterator& other) const {
 				return m_Ptr - other.m_Ptr;
 			}
 
-			ConstVectorIterator operator +(size_t uOffset) {
-				return ConstVectorIterator(m_Ptr + uOffset);
+			ConstVectorIterator operator +(difference_type iOffset) const {
+				return ConstVectorIterator(m_Ptr + iOffset);
 			}
 
-			ConstVectorIterator operator -(size_t uOffset) {
-				return ConstVectorIterator(m_Ptr - uOffset);
+			ConstVectorIterator operator -(difference_type iOffset) const {
+				return ConstVectorIterator(m_Ptr - iOffset);
 			}
 
-			ConstVectorIterator& operator +=(const ConstVectorIterator& other) {
-				m_Ptr += other.m_Ptr;
+			ConstVectorIterator& operator +=(difference_type iOffset) {
+				m_Ptr += iOffset;
 
 				return *this;
 			}
 
-			ConstVectorIterator& operator -=(const ConstVectorIterator& other) {
-				m_Ptr -= other.m_Ptr;
+			ConstVectorIterator& operator -=(difference_type iOffset) {
+				m_Ptr -= iOffset;
 
 				return *this;
 			}
 
-			ConstVectorIterator& operator +=(size_t uOffset) {
-				m_Ptr += uOffset;
-
-				return *this;
-			}
-
-			ConstVectorIterator& operator -=(size_t uOffset) {
-				m_Ptr -= uOffset;
-
-				return *this;
-			}
-
-			bool operator ==(const ConstVectorIterator& other) {
+			bool operator ==(const ConstVectorIterator& other) const {
 				return m_Ptr == other.m_Ptr;
 			}
 
-			bool operator !=(const ConstVectorIterator& other) {
+			bool operator !=(const ConstVectorIterator& other) const {
 				return m_Ptr != other.m_Ptr;
 			}
 
-			bool operator <(const ConstVectorIterator& other) {
+			bool operator <(const ConstVectorIterator& other) const {
 				return m_Ptr < other.m_Ptr;
 			}
 
-			bool operator <=(const ConstVectorIterator& other) {
+			bool operator <=(const ConstVectorIterator& other) const {
 				return m_Ptr <= other.m_Ptr;
 			}
 
-			bool operator >(const ConstVectorIterator& other) {
+			bool operator >(const ConstVectorIterator& other) const {
 				return m_Ptr > other.m_Ptr;
 			}
 
-			bool operator >=(const ConstVectorIterator& other) {
+			bool operator >=(const ConstVectorIterator& other) const {
 				return m_Ptr >= other.m_Ptr;
 			}
 
+			friend ConstVectorIterator operator +(difference_type iOffset, const ConstVectorIterator& itr) {
+				return itr + iOffset;
+			}
+
 		private:
-			ValueType* m_Ptr;
+			const ValueType* m_Ptr = nullptr;
 	};
 }
 
@@ -260,7 +263,9 @@ namespace nstd {
 				ReAlloc(uSize);
 
 				for (size_t i = 0; i < uSize; ++i)
-					m_pData[i] = value;
+					m_Allocator.construct(m_pData + i, value);
+
+				m_uSize = uSize;
 			}
 
 			//Allocates uSize number of elements and assigns them a default value
@@ -268,7 +273,9 @@ namespace nstd {
 				ReAlloc(uSize);
 
 				for (size_t i = 0; i < uSize; ++i)
-					m_pData[i] = T{};
+					m_Allocator.construct(m_pData + i);
+
+				m_uSize = uSize;
 			}
 
 			//Allocates enough memory to fit the [first; last) range and constructs a vector based on the iterators
@@ -284,7 +291,7 @@ namespace nstd {
 				m_uSize = uSize;
 
 				for (auto it = first; it != last; ++it, ++i)
-					m_pData[i] = *it;
+					m_Allocator.construct(m_pData + i, *it);
 			}
 
 			//Copy constructor
@@ -302,8 +309,9 @@ namespace nstd {
 				*this = list;
 			}
 
-			//Destructor, frees used space on the heap
+			//Destructor, destroys the elements and frees used space on the heap
 			~Vector() {
+				clear();
 				m_Allocator.deallocate(m_pData, m_uCapacity);
 			}
 
@@ -316,7 +324,7 @@ namespace nstd {
 				ReAlloc(other.m_uCapacity);
 
 				for (size_t i = 0; i < other.m_uSize; ++i)
-					m_pData[i] = other.m_pData[i];
+					m_Allocator.construct(m_pData + i, other.m_pData[i]);
 
 				m_uSize = other.m_uSize;
 
@@ -329,6 +337,7 @@ namespace nstd {
 					return *this;
 
 				clear();
+				m_Allocator.deallocate(m_pData, m_uCapacity);
 
 				m_pData		= other.m_pData;
 				m_uSize		= other.m_uSize;
@@ -343,16 +352,14 @@ namespace nstd {
 
 			//Clears the current vector, allocates memory for list.size() elements and copies them from the list
 			Vector& operator =(std::initializer_list<T> list) {
-				for (size_t i = 0; i < m_uSize; ++i)
-					m_pData[i].~T();
-
+				clear();
 				ReAlloc(list.size());
 				m_uSize = list.size();
 
 				size_t i = 0;
 
-				for (auto it = list.begin(); it != list.end(), i < m_uSize; ++it, ++i)
-					m_pData[i] = *it;
+				for (auto it = list.begin(); it != list.end() && i < m_uSize; ++it, ++i)
+					m_Allocator.construct(m_pData + i, *it);
 
 				return *this;
 			}
@@ -360,10 +367,12 @@ namespace nstd {
 			//Clears the vector, reallocates enough memory for 'count' elements and assigns vector elements to 'value's
 			void assign(size_t count, const T& value) {
 				clear();
-				ReAlloc(m_uSize);
+				ReAlloc(count);
 
-				for (size_t i = 0; i < m_uSize; ++i)
-					m_pData[i] = value;
+				for (size_t i = 0; i < count; ++i)
+					m_Allocator.construct(m_pData + i, value);
+
+				m_uSize = count;
 			}
 
 			//Clears the vector, reallocates enough memory to fit the [first, last) range and assigns vector elements baes on iterators
@@ -381,7 +390,7 @@ namespace nstd {
 				m_uSize = uSize;
 
 				for (auto it = first; it != last; ++it, ++i)
-					m_pData[i] = *it;
+					m_Allocator.construct(m_pData + i, *it);
 			}
 
 			//Look for: Vector& operator =(std::initializer_list<T> list)
@@ -467,6 +476,16 @@ namespace nstd {
 				return Iterator(m_pData + m_uSize);
 			}
 
+			//Returns a const iterator to the beginning of a vector
+			ConstIterator begin() const {
+				return ConstIterator(m_pData);
+			}
+
+			//Returns a const iterator to the element past the end of a vector
+			ConstIterator end() const {
+				return ConstIterator(m_pData + m_uSize);
+			}
+
 			//Returns an iterator to the element before the beginning of a vector
 			Iterator rbegin() {
 				return Iterator(m_pData - 1);
@@ -478,22 +497,22 @@ namespace nstd {
 			}
 
 			//Returns an const iterator to the beginning of a vector
-			ConstIterator cbegin() {
+			ConstIterator cbegin() const {
 				return ConstIterator(m_pData);
 			}
 
 			//Returns an const iterator to the element past the end of a vector
-			ConstIterator cend() {
+			ConstIterator cend() const {
 				return ConstIterator(m_pData + m_uSize);
 			}
 
 			//Returns an const iterator to the element before the beginning of a vector
-			ConstIterator crbegin() {
+			ConstIterator crbegin() const {
 				return ConstIterator(m_pData - 1);
 			}
 
 			//Returns an const iterator to the end of a vector
-			ConstIterator crend() {
+			ConstIterator crend() const {
 				return ConstIterator(m_pData + m_uSize - 1);
 			}
 			
@@ -680,7 +699,7 @@ namespace nstd {
 
 				size_t len = pos - begin();
 				
-				m_Allocator.destroy(pos);
+				m_Allocator.destroy(std::to_address(pos));
 				memmove_s(m_pData + len,
 						  (m_uCapacity - len) * sizeof(T),
 						  m_pData + len + 1,
@@ -714,18 +733,18 @@ namespace nstd {
 			//Copies the given value and puts it on the end of the container. Reallocates the entire block if necessary
 			void push_back(const T& value) {
 				if (m_uSize >= m_uCapacity)
-					ReAlloc(m_uCapacity + m_uCapacity / 2);
+					ReAlloc(m_uCapacity + m_uCapacity / 2 + 1);
 
-				m_pData[m_uSize] = value;
+				m_Allocator.construct(m_pData + m_uSize, value);
 				m_uSize++;
 			}
 
 			//Moves the given value and puts it on the end of the container. Reallocates the entire block if necessary
 			void push_back(T&& value) {
 				if (m_uSize >= m_uCapacity)
-					ReAlloc(m_uCapacity + m_uCapacity / 2);
+					ReAlloc(m_uCapacity + m_uCapacity / 2 + 1);
 
-				m_pData[m_uSize] = std::move(value);
+				m_Allocator.construct(m_pData + m_uSize, std::move(value));
 				m_uSize++;
 			}
 
@@ -733,7 +752,7 @@ namespace nstd {
 			template<typename... Args>
 			T& emplace_back(Args&&... args) {
 				if (m_uSize >= m_uCapacity)
-					ReAlloc(m_uCapacity + m_uCapacity / 2);
+					ReAlloc(m_uCapacity + m_uCapacity / 2 + 1);
 
 				new(m_pData + m_uSize) T(std::forward<Args>(args)...);
 
@@ -743,7 +762,7 @@ namespace nstd {
 			//If there are any elements, calls a destructor of the last element and decrements the size of a container
 			void pop_back() {
 				if (m_uSize > 0)
-					m_Allocator.destroy(m_pData + (m_uSize--));
+					m_Allocator.destroy(m_pData + (--m_uSize));
 			}
 
 			//Resizes the container. If necessary, will reallocate the memory block to a proper size
@@ -757,7 +776,9 @@ namespace nstd {
 						ReAlloc(uNewSize);
 
 					for (size_t i = m_uSize; i < uNewSize; ++i)
-						m_pData[i] = value;
+						m_Allocator.construct(m_pData + i, value);
+
+					m_uSize = uNewSize;
 				}
 			}
 
@@ -777,8 +798,10 @@ namespace nstd {
 			void ReAlloc(size_t uNewCap) {
 				T* pNewBlock = m_Allocator.allocate(uNewCap);
 
-				for (size_t i = 0; i < m_uSize; ++i)
-					pNewBlock[i] = std::move(m_pData[i]);
+				for (size_t i = 0; i < m_uSize; ++i) {
+					m_Allocator.construct(pNewBlock + i, std::move(m_pData[i]));
+					m_Allocator.destroy(m_pData + i);
+				}
 
 				m_Allocator.deallocate(m_pData, m_uCapacity);
 				m_pData = pNewBlock;
@@ -786,7 +809,7 @@ namespace nstd {
 			}
 
 		private:
-			T*	   m_pData;
+			T*	   m_pData	   = nullptr;
 			size_t m_uSize	   = 0;
 			size_t m_uCapacity = 0;
 			Alloc  m_Allocator;
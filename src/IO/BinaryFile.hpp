@@ -0,0 +1,420 @@
+#pragma once
+
+#include <cstdio>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "MappedFile.hpp"
+
+namespace nstd {
+	namespace detail {
+		// "NSTD" in the order the bytes are stored in the file
+		constexpr uint32_t BINARY_MAGIC		 = 0x4454534E;
+		constexpr uint16_t BINARY_VERSION	 = 1;
+		// Reads back as 0x0201 on a machine of the other endianness
+		constexpr uint16_t BINARY_BYTE_ORDER = 0x0102;
+		// Set when uChecksum covers the payload
+		constexpr uint32_t BINARY_CHECKSUMMED = 1;
+
+		// Size of the blocks files are written and read in when they aren't mapped
+		constexpr size_t BINARY_BLOCK_BYTES = 1024 * 1024;
+
+		// Starts every binary file, followed by uCount elements of uElementSize bytes each. Padded to 64 bytes, so
+		// a payload mapped at a page boundary is aligned for any element
+		struct BinaryHeader {
+			uint32_t uMagic;
+			uint16_t uVersion;
+			uint16_t uByteOrder;
+			uint32_t uHeaderSize;
+			uint32_t uElementSize;
+			uint32_t uFlags;
+			uint32_t uReserved;
+			uint64_t uCount;
+			uint64_t uChecksum;
+			uint8_t	 Padding[24];
+		};
+
+		static_assert(sizeof(BinaryHeader) == 64, "BinaryHeader must stay 64 bytes");
+
+		// True if the header was written on a machine of this byte order for elements of uElementSize bytes, and the
+		// file of uFileSize bytes holds exactly the elements it announces
+		inline bool IsValidBinaryHeader(const BinaryHeader& header, uint64_t uFileSize, size_t uElementSize) {
+			if (header.uMagic != BINARY_MAGIC || header.uVersion != BINARY_VERSION || header.uByteOrder != BINARY_BYTE_ORDER ||
+				header.uHeaderSize != sizeof(BinaryHeader) || header.uElementSize != uElementSize || uElementSize == 0 ||
+				uFileSize < sizeof(BinaryHeader))
+				return false;
+
+			uint64_t uPayload = uFileSize - sizeof(BinaryHeader);
+
+			return uPayload % uElementSize == 0 && uPayload / uElementSize == header.uCount;
+		}
+
+		// Streaming 64-bit checksum of a byte sequence. Four independent lanes each take 8 bytes per step, after the
+		// manner of xxHash, so it runs well above disk bandwidth. The result doesn't depend on how the sequence was
+		// split between the calls to update
+		class BinaryChecksum {
+			public:
+				void update(const void* pData, size_t uBytes) {
+					const unsigned char* pBytes = static_cast<const unsigned char*>(pData);
+
+					m_uTotal += uBytes;
+
+					if (m_uPending > 0) {
+						size_t uTake = uBytes < STRIPE - m_uPending ? uBytes : STRIPE - m_uPending;
+
+						std::memcpy(m_Pending + m_uPending, pBytes, uTake);
+						m_uPending += uTake;
+						pBytes	   += uTake;
+						uBytes	   -= uTake;
+
+						if (m_uPending < STRIPE)
+							return;
+
+						Consume(m_Pending);
+						m_uPending = 0;
+					}
+
+					for (; uBytes >= STRIPE; pBytes += STRIPE, uBytes -= STRIPE)
+						Consume(pBytes);
+
+					std::memcpy(m_Pending, pBytes, uBytes);
+					m_uPending = uBytes;
+				}
+
+				uint64_t value() const {
+					uint64_t uHash = Rotate(m_uLanes[0], 1) + Rotate(m_uLanes[1], 7) + Rotate(m_uLanes[2], 12) + Rotate(m_uLanes[3], 18);
+
+					uHash ^= m_uTotal;
+
+					for (size_t i = 0; i < m_uPending; ++i)
+						uHash = Rotate(uHash ^ (m_Pending[i] * PRIME_5), 11) * PRIME_1;
+
+					uHash ^= uHash >> 33;
+					uHash *= PRIME_2;
+					uHash ^= uHash >> 29;
+					uHash *= PRIME_3;
+					uHash ^= uHash >> 32;
+
+					return uHash;
+				}
+
+			private:
+				static uint64_t Rotate(uint64_t uValue, int iBits) {
+					return (uValue << iBits) | (uValue >> (64 - iBits));
+				}
+
+				void Consume(const unsigned char* pStripe) {
+					for (size_t i = 0; i < 4; ++i) {
+						uint64_t uWord;
+
+						std::memcpy(&uWord, pStripe + i * 8, 8);
+						m_uLanes[i] = Rotate(m_uLanes[i] + uWord * PRIME_2, 31) * PRIME_1;
+					}
+				}
+
+			private:
+				static constexpr size_t	  STRIPE  = 32;
+				static constexpr uint64_t PRIME_1 = 0x9E3779B185EBCA87ull;
+				static constexpr uint64_t PRIME_2 = 0xC2B2AE3D27D4EB4Full;
+				static constexpr uint64_t PRIME_3 = 0x165667B19E3779F9ull;
+				static constexpr uint64_t PRIME_5 = 0x27D4EB2F165667C5ull;
+
+			private:
+				uint64_t	  m_uLanes[4] = { PRIME_1 + PRIME_2, PRIME_2, 0, 0 - PRIME_1 };
+				uint64_t	  m_uTotal	  = 0;
+				unsigned char m_Pending[STRIPE];
+				size_t		  m_uPending  = 0;
+		};
+	}
+
+	// Writes a binary file of fixed size elements: a header recording their size, count, byte order and checksum,
+	// then the elements themselves. Small writes are gathered into BINARY_BLOCK_BYTES blocks and large ones go to
+	// the file directly, so the file is written in a few big calls whatever the element size.
+	// The header is only filled in by close(), a file that wasn't closed successfully fails to read
+	class BinaryWriter {
+		public:
+			BinaryWriter() = default;
+
+			BinaryWriter(const BinaryWriter&) = delete;
+			BinaryWriter& operator =(const BinaryWriter&) = delete;
+
+			~BinaryWriter() {
+				if (m_pFile)
+					std::fclose(m_pFile);
+			}
+
+			// Creates or truncates the file at pPath for elements of uElementSize bytes
+			bool open(const char* pPath, size_t uElementSize) {
+				if (m_pFile)
+					std::fclose(m_pFile);
+
+				m_pFile		   = std::fopen(pPath, "wb");
+				m_uElementSize = uElementSize;
+				m_uCount	   = 0;
+				m_uBuffered	   = 0;
+				m_Checksum	   = detail::BinaryChecksum();
+				m_bFailed	   = false;
+
+				if (!m_pFile)
+					return false;
+
+				// Blocks are gathered here already, the stream's own buffer would only add a copy
+				std::setvbuf(m_pFile, nullptr, _IONBF, 0);
+
+				if (!m_pBuffer)
+					m_pBuffer.reset(new unsigned char[detail::BINARY_BLOCK_BYTES]);
+
+				// Reserves room for the header
+				detail::BinaryHeader header{};
+
+				m_bFailed = std::fwrite(&header, sizeof(header), 1, m_pFile) != 1;
+
+				return !m_bFailed;
+			}
+
+			// Appends uCount elements stored contiguously at pData
+			bool write(const void* pData, size_t uCount) {
+				size_t uBytes = uCount * m_uElementSize;
+
+				if (!m_pFile || m_bFailed)
+					return false;
+
+				m_uCount += uCount;
+
+				if (m_uBuffered + uBytes <= detail::BINARY_BLOCK_BYTES) {
+					std::memcpy(m_pBuffer.get() + m_uBuffered, pData, uBytes);
+					m_uBuffered += uBytes;
+
+					return true;
+				}
+
+				if (!Flush())
+					return false;
+
+				if (uBytes < detail::BINARY_BLOCK_BYTES) {
+					std::memcpy(m_pBuffer.get(), pData, uBytes);
+					m_uBuffered = uBytes;
+
+					return true;
+				}
+
+				m_Checksum.update(pData, uBytes);
+				m_bFailed = std::fwrite(pData, 1, uBytes, m_pFile) != uBytes;
+
+				return !m_bFailed;
+			}
+
+			// Writes out what is buffered, fills in the header and closes the file.
+			// Returns false if anything failed since open
+			bool close() {
+				if (!m_pFile)
+					return false;
+
+				Flush();
+
+				detail::BinaryHeader header{};
+
+				header.uMagic		= detail::BINARY_MAGIC;
+				header.uVersion		= detail::BINARY_VERSION;
+				header.uByteOrder	= detail::BINARY_BYTE_ORDER;
+				header.uHeaderSize	= sizeof(detail::BinaryHeader);
+				header.uElementSize = (uint32_t)m_uElementSize;
+				header.uFlags		= detail::BINARY_CHECKSUMMED;
+				header.uCount		= m_uCount;
+				header.uChecksum	= m_Checksum.value();
+
+				if (!m_bFailed)
+					m_bFailed = std::fseek(m_pFile, 0, SEEK_SET) != 0 || std::fwrite(&header, sizeof(header), 1, m_pFile) != 1;
+
+				m_bFailed = std::fclose(m_pFile) != 0 || m_bFailed;
+				m_pFile	  = nullptr;
+
+				return !m_bFailed;
+			}
+
+		private:
+			bool Flush() {
+				if (m_uBuffered > 0 && !m_bFailed) {
+					m_Checksum.update(m_pBuffer.get(), m_uBuffered);
+					m_bFailed = std::fwrite(m_pBuffer.get(), 1, m_uBuffered, m_pFile) != m_uBuffered;
+				}
+
+				m_uBuffered = 0;
+
+				return !m_bFailed;
+			}
+
+		private:
+			std::FILE*					   m_pFile		  = nullptr;
+			std::unique_ptr<unsigned char[]> m_pBuffer;
+			size_t						   m_uBuffered	  = 0;
+			size_t						   m_uElementSize = 0;
+			uint64_t					   m_uCount		  = 0;
+			detail::BinaryChecksum		   m_Checksum;
+			bool						   m_bFailed	  = false;
+	};
+
+	// Reads a file made by BinaryWriter. open() rejects files with a different magic, version, byte order or element
+	// size, and files whose length doesn't match the element count. The elements are then consumed front to back,
+	// copied out by read() or, where the file is memory mapped, looked at in place through view(). The checksum is
+	// accumulated along the way and compared by close(), once every element has been consumed
+	class BinaryReader {
+		public:
+			BinaryReader() = default;
+
+			BinaryReader(const BinaryReader&) = delete;
+			BinaryReader& operator =(const BinaryReader&) = delete;
+
+			~BinaryReader() {
+				if (m_pFile)
+					std::fclose(m_pFile);
+			}
+
+			bool open(const char* pPath, size_t uElementSize) {
+				Reset();
+
+				detail::BinaryHeader header;
+				uint64_t			 uFileSize;
+
+			#ifdef NSTD_HAS_MMAP
+				if (!m_Mapping.open(pPath, true) || m_Mapping.size() < sizeof(header))
+					return Reset();
+
+				std::memcpy(&header, m_Mapping.data(), sizeof(header));
+				uFileSize = m_Mapping.size();
+			#else
+				m_pFile = std::fopen(pPath, "rb");
+
+				if (!m_pFile || std::fread(&header, sizeof(header), 1, m_pFile) != 1)
+					return Reset();
+
+				std::setvbuf(m_pFile, nullptr, _IONBF, 0);
+
+				if (std::fseek(m_pFile, 0, SEEK_END) != 0)
+					return Reset();
+
+				uFileSize = (uint64_t)std::ftell(m_pFile);
+
+				if (std::fseek(m_pFile, (long)sizeof(header), SEEK_SET) != 0)
+					return Reset();
+			#endif
+
+				if (!detail::IsValidBinaryHeader(header, uFileSize, uElementSize))
+					return Reset();
+
+				m_uElementSize = uElementSize;
+				m_uCount	   = header.uCount;
+				m_uRemaining   = header.uCount;
+				m_uExpected	   = header.uChecksum;
+				m_bChecksummed = (header.uFlags & detail::BINARY_CHECKSUMMED) != 0;
+				m_uOffset	   = sizeof(header);
+
+				return true;
+			}
+
+			// Number of elements in the file
+			size_t count() const {
+				return (size_t)m_uCount;
+			}
+
+			// Copies the next uCount elements to pDest. Fails if fewer are left
+			bool read(void* pDest, size_t uCount) {
+				if (uCount > m_uRemaining)
+					return false;
+
+				size_t uBytes = uCount * m_uElementSize;
+
+			#ifdef NSTD_HAS_MMAP
+				std::memcpy(pDest, m_Mapping.data() + m_uOffset, uBytes);
+			#else
+				if (std::fread(pDest, 1, uBytes, m_pFile) != uBytes)
+					return false;
+			#endif
+
+				Consume(pDest, uCount);
+
+				return true;
+			}
+
+			// Returns the next uCount elements where they lie in the mapped file and consumes them, or nullptr if fewer are
+			// left or the file isn't mapped on this platform, in which case they are left to read()
+			const void* view(size_t uCount) {
+			#ifdef NSTD_HAS_MMAP
+				if (uCount > m_uRemaining)
+					return nullptr;
+
+				const void* pData = m_Mapping.data() + m_uOffset;
+
+				Consume(pData, uCount);
+
+				return pData;
+			#else
+				(void)uCount;
+
+				return nullptr;
+			#endif
+			}
+
+			// True once all the elements were consumed and matched the checksum. Data returned by view() stays
+			// valid until close, so it can be checked before being used
+			bool intact() const {
+				return m_uRemaining == 0 && (!m_bChecksummed || m_Checksum.value() == m_uExpected);
+			}
+
+			// Closes the file, returns intact()
+			bool close() {
+				bool bIntact = intact();
+
+				Reset();
+
+				return bIntact;
+			}
+
+		private:
+			void Consume(const void* pData, size_t uCount) {
+				size_t uBytes = uCount * m_uElementSize;
+
+				if (m_bChecksummed)
+					m_Checksum.update(pData, uBytes);
+
+				m_uOffset	 += uBytes;
+				m_uRemaining -= uCount;
+			}
+
+			// Always returns false, for the failure paths of open
+			bool Reset() {
+			#ifdef NSTD_HAS_MMAP
+				m_Mapping.close();
+			#endif
+
+				if (m_pFile)
+					std::fclose(m_pFile);
+
+				m_pFile		   = nullptr;
+				m_uElementSize = 0;
+				m_uCount	   = 0;
+				m_uRemaining   = 0;
+				m_uOffset	   = 0;
+				m_uExpected	   = 0;
+				m_bChecksummed = false;
+				m_Checksum	   = detail::BinaryChecksum();
+
+				return false;
+			}
+
+		private:
+		#ifdef NSTD_HAS_MMAP
+			MappedFile			   m_Mapping;
+		#endif
+			std::FILE*			   m_pFile		  = nullptr;
+			size_t				   m_uElementSize = 0;
+			uint64_t			   m_uCount		  = 0;
+			uint64_t			   m_uRemaining	  = 0;
+			size_t				   m_uOffset	  = 0;
+			uint64_t			   m_uExpected	  = 0;
+			bool				   m_bChecksummed = false;
+			detail::BinaryChecksum m_Checksum;
+	};
+}
\ No newline at end of file
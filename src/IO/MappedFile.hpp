@@ -0,0 +1,224 @@
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+	#define NSTD_HAS_MMAP 1
+	#include <fcntl.h>
+	#include <unistd.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+#endif
+
+namespace nstd {
+#ifdef NSTD_HAS_MMAP
+	// Maps a whole file into memory. Pages are loaded from the page cache on first touch, so opening costs the same
+	// for any file size and nothing is copied into the process. Read only mappings keep the file's contents alive by
+	// themselves and close the descriptor as soon as they are made. Writable ones share their pages with the file,
+	// keep the descriptor to resize it, and leave writing the pages back to the kernel unless flushed
+	class MappedFile {
+		public:
+			MappedFile() = default;
+
+			MappedFile(const MappedFile&) = delete;
+			MappedFile& operator =(const MappedFile&) = delete;
+
+			MappedFile(MappedFile&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			MappedFile& operator =(MappedFile&& other) noexcept {
+				if (this != &other) {
+					close();
+
+					std::swap(m_pData, other.m_pData);
+					std::swap(m_uSize, other.m_uSize);
+					std::swap(m_iFile, other.m_iFile);
+				}
+
+				return *this;
+			}
+
+			~MappedFile() {
+				close();
+			}
+
+			// Maps the file at pPath, closing the previous mapping. bSequential tells the kernel that the file will be read
+			// front to back, so it reads ahead further and drops pages behind the reader sooner.
+			// Returns false if the file can't be opened or mapped, empty files included
+			bool open(const char* pPath, bool bSequential = false) {
+				close();
+
+				int iFile = ::open(pPath, O_RDONLY | O_CLOEXEC);
+
+				if (iFile < 0)
+					return false;
+
+				struct stat info;
+
+				if (fstat(iFile, &info) != 0 || info.st_size <= 0) {
+					::close(iFile);
+					return false;
+				}
+
+			#ifdef POSIX_FADV_SEQUENTIAL
+				if (bSequential)
+					posix_fadvise(iFile, 0, 0, POSIX_FADV_SEQUENTIAL);
+			#endif
+
+				int iFlags = MAP_PRIVATE;
+
+			#ifdef MAP_POPULATE
+				// The whole file is about to be read anyway, mapping it all up front saves a page fault per page
+				if (bSequential)
+					iFlags |= MAP_POPULATE;
+			#endif
+
+				void* pData = mmap(nullptr, (size_t)info.st_size, PROT_READ, iFlags, iFile, 0);
+
+				::close(iFile);
+
+				if (pData == MAP_FAILED)
+					return false;
+
+				if (bSequential)
+					madvise(pData, (size_t)info.st_size, MADV_SEQUENTIAL);
+
+				m_pData = static_cast<unsigned char*>(pData);
+				m_uSize = (size_t)info.st_size;
+
+				return true;
+			}
+
+			// Maps the file at pPath for reading and writing, closing the previous mapping. A missing or empty file is
+			// created with uMinSize zero bytes, and pCreated tells whether that happened. Any other file is left as it is,
+			// so one shorter than uMinSize is rejected. Returns false if the file can't be opened or mapped
+			bool open_writable(const char* pPath, size_t uMinSize, bool* pCreated = nullptr) {
+				close();
+
+				m_iFile = ::open(pPath, O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+
+				if (m_iFile < 0)
+					return false;
+
+				struct stat info;
+
+				if (fstat(m_iFile, &info) != 0) {
+					close();
+					return false;
+				}
+
+				size_t uSize	= (size_t)info.st_size;
+				bool   bCreated = uSize == 0;
+
+				if (bCreated) {
+					if (ftruncate(m_iFile, (off_t)uMinSize) != 0) {
+						close();
+						return false;
+					}
+
+					uSize = uMinSize;
+				}
+				else if (uSize < uMinSize) {
+					close();
+					return false;
+				}
+
+				void* pData = uSize > 0 ? mmap(nullptr, uSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_iFile, 0) : MAP_FAILED;
+
+				if (pData == MAP_FAILED) {
+					close();
+					return false;
+				}
+
+				m_pData = static_cast<unsigned char*>(pData);
+				m_uSize = uSize;
+
+				if (pCreated)
+					*pCreated = bCreated;
+
+				return true;
+			}
+
+			// Grows or shrinks a writable file and its mapping to uNewSize bytes. Where mremap exists the mapping is
+			// extended in place or moved by the kernel without copying, otherwise it is remapped. Either way pointers into
+			// it may become dangling. Returns false, keeping the old mapping, if the file can't be resized
+			bool resize(size_t uNewSize) {
+				if (m_iFile < 0 || uNewSize == 0)
+					return false;
+
+				// A file shrunk under a mapping would fault on access past its end, so the mapping shrinks first
+				if (uNewSize > m_uSize && ftruncate(m_iFile, (off_t)uNewSize) != 0)
+					return false;
+
+			#ifdef MREMAP_MAYMOVE
+				void* pData = mremap(m_pData, m_uSize, uNewSize, MREMAP_MAYMOVE);
+			#else
+				void* pData = mmap(nullptr, uNewSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_iFile, 0);
+
+				if (pData != MAP_FAILED)
+					munmap(m_pData, m_uSize);
+			#endif
+
+				if (pData == MAP_FAILED) {
+					if (uNewSize > m_uSize)
+						ftruncate(m_iFile, (off_t)m_uSize);
+
+					return false;
+				}
+
+				bool bShrunk = uNewSize < m_uSize;
+
+				m_pData = static_cast<unsigned char*>(pData);
+				m_uSize = uNewSize;
+
+				return !bShrunk || ftruncate(m_iFile, (off_t)uNewSize) == 0;
+			}
+
+			// Writes the modified pages of a writable mapping back to the file. With bAsync the writes are only scheduled
+			// and the call returns at once, otherwise it returns once they reached the disk
+			bool flush(bool bAsync = false) {
+				if (m_iFile < 0)
+					return false;
+
+				return msync(m_pData, m_uSize, bAsync ? MS_ASYNC : MS_SYNC) == 0;
+			}
+
+			// Unmaps the file, pointers into it become dangling. Modified pages still reach the file,
+			// but only when the kernel gets to them
+			void close() {
+				if (m_pData)
+					munmap(m_pData, m_uSize);
+
+				if (m_iFile >= 0)
+					::close(m_iFile);
+
+				m_pData = nullptr;
+				m_uSize = 0;
+				m_iFile = -1;
+			}
+
+			bool is_open() const {
+				return m_pData != nullptr;
+			}
+
+			unsigned char* data() {
+				return m_pData;
+			}
+
+			const unsigned char* data() const {
+				return m_pData;
+			}
+
+			size_t size() const {
+				return m_uSize;
+			}
+
+		private:
+			unsigned char* m_pData = nullptr;
+			size_t		   m_uSize = 0;
+			int			   m_iFile = -1;
+	};
+#endif
+}
\ No newline at end of file
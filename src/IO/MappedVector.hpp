@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "MappedFile.hpp"
+#include "BinaryFile.hpp"
+#include "../Containers/Span.hpp"
+
+namespace nstd {
+#ifdef NSTD_HAS_MMAP
+	// Read-only view of the elements in a file written by one of the save functions of Serialization.hpp,
+	// mapped into memory instead of being read. Opening only validates the header, so it takes the same time for
+	// any file size, and the elements are paged in from the page cache as they are first touched. Processes that
+	// map the same file share its pages. The checksum isn't checked unless verify() is called, since that reads
+	// the whole file
+	template<typename T>
+	class MappedVector {
+		public:
+			using ValueType		= const T;
+			using ConstIterator = ConstVectorIterator<MappedVector<T>>;
+			using Iterator		= ConstIterator;
+
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be mapped from bytes");
+			static_assert(alignof(T) <= sizeof(detail::BinaryHeader), "The payload is only aligned to the header size");
+
+		public:
+			MappedVector() = default;
+
+			MappedVector(MappedVector&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			// Takes over the mapping of other, leaving it closed
+			MappedVector& operator =(MappedVector&& other) noexcept {
+				if (this != &other) {
+					m_File	 = std::move(other.m_File);
+					m_Header = other.m_Header;
+
+					other.m_Header = detail::BinaryHeader{};
+				}
+
+				return *this;
+			}
+
+			// Maps the file at pPath, closing the previous one. Returns false, leaving the vector closed, if the file
+			// can't be mapped or its header doesn't match T and this machine's byte order
+			bool open(const char* pPath) {
+				close();
+
+				if (!m_File.open(pPath))
+					return false;
+
+				if (m_File.size() >= sizeof(m_Header))
+					std::memcpy(&m_Header, m_File.data(), sizeof(m_Header));
+
+				if (!detail::IsValidBinaryHeader(m_Header, m_File.size(), sizeof(T))) {
+					close();
+					return false;
+				}
+
+				return true;
+			}
+
+			// Unmaps the file, invalidating every pointer, reference and span into it
+			void close() {
+				m_File.close();
+				m_Header = detail::BinaryHeader{};
+			}
+
+			bool is_open() const {
+				return m_File.is_open();
+			}
+
+			// Reads every element and compares them to the checksum stored in the file
+			bool verify() const {
+				if (!is_open())
+					return false;
+
+				if (!(m_Header.uFlags & detail::BINARY_CHECKSUMMED))
+					return true;
+
+				detail::BinaryChecksum checksum;
+
+				checksum.update(data(), size() * sizeof(T));
+
+				return checksum.value() == m_Header.uChecksum;
+			}
+
+			// Accesses data()[uIndex]. If uIndex is invalid, throws an exception
+			const T& at(size_t uIndex) const {
+				if (uIndex >= size())
+					throw std::out_of_range("Invalid index");
+
+				return data()[uIndex];
+			}
+
+			const T& operator [](size_t uIndex) const {
+				return data()[uIndex];
+			}
+
+			const T& front() const {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return data()[0];
+			}
+
+			const T& back() const {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return data()[size() - 1];
+			}
+
+			// Points into the mapping, nullptr while closed
+			const T* data() const {
+				return is_open() ? reinterpret_cast<const T*>(m_File.data() + sizeof(detail::BinaryHeader)) : nullptr;
+			}
+
+			Span<const T> span() const {
+				return Span<const T>(data(), size());
+			}
+
+			ConstIterator begin() const {
+				return ConstIterator(data());
+			}
+
+			ConstIterator end() const {
+				return ConstIterator(data() + size());
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+			bool empty() const {
+				return size() == 0;
+			}
+
+			size_t size() const {
+				return (size_t)m_Header.uCount;
+			}
+
+		private:
+			MappedFile			 m_File;
+			detail::BinaryHeader m_Header{};
+	};
+#endif
+}
\ No newline at end of file
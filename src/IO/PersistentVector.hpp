@@ -0,0 +1,352 @@
+#pragma once
+
+#include <new>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "MappedFile.hpp"
+#include "BinaryFile.hpp"
+#include "../Containers/Vector.hpp"
+
+namespace nstd {
+#ifdef NSTD_HAS_MMAP
+	// Vector whose storage is a memory mapped file, so its elements outlive the process and may outgrow the RAM:
+	// the kernel pages them in and out like any file. The file is a binary header followed by the capacity, and
+	// the header's count is updated in place with every change, so reopening the file after a crash picks up
+	// every element whose pages the kernel kept, which is all of them unless the machine itself went down.
+	// flush() makes them durable against that as well. close() trims the unused capacity, after which the file can
+	// also be read by the load functions of Serialization.hpp or by MappedVector, minus the checksum, which isn't
+	// kept up to date. Growing extends the file and its mapping, which may move the elements like a Vector
+	// reallocation would. Modifying a vector that isn't open throws std::logic_error
+	template<typename T>
+	class PersistentVector {
+		public:
+			using ValueType		= T;
+			using Iterator		= VectorIterator<PersistentVector<T>>;
+			using ConstIterator = ConstVectorIterator<PersistentVector<T>>;
+
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be kept in a file");
+			static_assert(alignof(T) <= sizeof(detail::BinaryHeader), "The elements are only aligned to the header size");
+
+		public:
+			PersistentVector() = default;
+
+			PersistentVector(const PersistentVector&) = delete;
+			PersistentVector& operator =(const PersistentVector&) = delete;
+
+			PersistentVector(PersistentVector&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			// Closes this vector and takes over the file of other, leaving it closed
+			PersistentVector& operator =(PersistentVector&& other) noexcept {
+				if (this != &other) {
+					close();
+
+					m_File		= std::move(other.m_File);
+					m_uCapacity = other.m_uCapacity;
+
+					other.m_uCapacity = 0;
+				}
+
+				return *this;
+			}
+
+			// Trims the file and closes it, look for: close
+			~PersistentVector() {
+				close();
+			}
+
+			// Opens the file at pPath, closing the previous one, or creates it empty if it doesn't exist.
+			// Returns false, leaving the vector closed, if the file can't be mapped or its header doesn't match T
+			bool open(const char* pPath) {
+				close();
+
+				bool bCreated = false;
+
+				// Existing files are only written to once their header checked out
+				if (!m_File.open_writable(pPath, sizeof(detail::BinaryHeader), &bCreated))
+					return false;
+
+				detail::BinaryHeader* pHeader = Header();
+				size_t				  uPayload = m_File.size() - sizeof(detail::BinaryHeader);
+
+				if (bCreated) {
+					*pHeader = detail::BinaryHeader{};
+
+					pHeader->uMagic		  = detail::BINARY_MAGIC;
+					pHeader->uVersion	  = detail::BINARY_VERSION;
+					pHeader->uByteOrder	  = detail::BINARY_BYTE_ORDER;
+					pHeader->uHeaderSize  = sizeof(detail::BinaryHeader);
+					pHeader->uElementSize = sizeof(T);
+				}
+
+				// Files left open by a crash still have their spare capacity, so there may be more payload than elements
+				if (pHeader->uMagic != detail::BINARY_MAGIC || pHeader->uVersion != detail::BINARY_VERSION ||
+					pHeader->uByteOrder != detail::BINARY_BYTE_ORDER || pHeader->uHeaderSize != sizeof(detail::BinaryHeader) ||
+					pHeader->uElementSize != sizeof(T) || pHeader->uCount > uPayload / sizeof(T)) {
+					m_File.close();
+					return false;
+				}
+
+				// The checksum can't follow every change, readers are told to ignore it
+				pHeader->uFlags &= ~detail::BINARY_CHECKSUMMED;
+				m_uCapacity = uPayload / sizeof(T);
+
+				return true;
+			}
+
+			// Shrinks the file to the elements it holds and closes it. Doesn't wait for the pages to reach the disk,
+			// look for: flush
+			void close() {
+				if (!is_open())
+					return;
+
+				m_File.resize(sizeof(detail::BinaryHeader) + size() * sizeof(T));
+				m_File.close();
+				m_uCapacity = 0;
+			}
+
+			bool is_open() const {
+				return m_File.is_open();
+			}
+
+			// Writes the modified pages back to the file. With bAsync the writes are only scheduled and it returns
+			// at once, otherwise it returns once everything reached the disk
+			bool flush(bool bAsync = false) {
+				return m_File.flush(bAsync);
+			}
+
+			// Accesses data()[uIndex] and returns a reference. If uIndex is invalid, throws an exception
+			T& at(size_t uIndex) {
+				if (uIndex >= size())
+					throw std::out_of_range("Invalid index");
+
+				return data()[uIndex];
+			}
+
+			// Accesses data()[uIndex] and returns a const reference. If uIndex is invalid, throws an exception
+			const T& at(size_t uIndex) const {
+				if (uIndex >= size())
+					throw std::out_of_range("Invalid index");
+
+				return data()[uIndex];
+			}
+
+			T& operator [](size_t uIndex) {
+				return data()[uIndex];
+			}
+
+			const T& operator [](size_t uIndex) const {
+				return data()[uIndex];
+			}
+
+			// Returns a reference to the first element. If there are no elements, throws an exception
+			T& front() {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return data()[0];
+			}
+
+			const T& front() const {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return data()[0];
+			}
+
+			// Returns a reference to the last element. If there are no elements, throws an exception
+			T& back() {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return data()[size() - 1];
+			}
+
+			const T& back() const {
+				if (empty())
+					throw std::out_of_range("No elements in the container");
+
+				return data()[size() - 1];
+			}
+
+			// Points into the mapping, nullptr while closed
+			T* data() {
+				return is_open() ? reinterpret_cast<T*>(m_File.data() + sizeof(detail::BinaryHeader)) : nullptr;
+			}
+
+			const T* data() const {
+				return is_open() ? reinterpret_cast<const T*>(m_File.data() + sizeof(detail::BinaryHeader)) : nullptr;
+			}
+
+			Iterator begin() {
+				return Iterator(data());
+			}
+
+			Iterator end() {
+				return Iterator(data() + size());
+			}
+
+			ConstIterator begin() const {
+				return ConstIterator(data());
+			}
+
+			ConstIterator end() const {
+				return ConstIterator(data() + size());
+			}
+
+			ConstIterator cbegin() const {
+				return begin();
+			}
+
+			ConstIterator cend() const {
+				return end();
+			}
+
+			bool empty() const {
+				return size() == 0;
+			}
+
+			size_t size() const {
+				return is_open() ? (size_t)Header()->uCount : 0;
+			}
+
+			size_t capacity() const {
+				return m_uCapacity;
+			}
+
+			// If uNewCap is greater than the current capacity, grows the file to fit exactly uNewCap elements
+			void reserve(size_t uNewCap) {
+				if (uNewCap > m_uCapacity)
+					ReAlloc(uNewCap);
+			}
+
+			// Shrinks the file to the elements it holds
+			void shrink_to_fit() {
+				if (size() < m_uCapacity)
+					ReAlloc(size());
+			}
+
+			// Forgets every element, the file keeps its capacity
+			void clear() {
+				if (is_open())
+					Header()->uCount = 0;
+			}
+
+			// Copies the given value to the end of the container. Grows the file if necessary
+			void push_back(const T& value) {
+				emplace_back(value);
+			}
+
+			// Constructs a T instance with given arguments in place of the next free space in the file. Grows the file if necessary
+			template<typename... Args>
+			T& emplace_back(Args&&... args) {
+				CheckOpen();
+
+				size_t uSize = size();
+
+				// Built before growing, the arguments may refer to elements the growth moves
+				T element(std::forward<Args>(args)...);
+
+				if (uSize >= m_uCapacity)
+					ReAlloc(m_uCapacity + m_uCapacity / 2 + MIN_GROWTH);
+
+				T* pSlot = new(data() + uSize) T(element);
+
+				// Counted only once written, a crash in between doesn't expose a torn element
+				Header()->uCount = uSize + 1;
+
+				return *pSlot;
+			}
+
+			// Appends uCount elements stored contiguously at pData with a single copy. Grows the file if necessary
+			void append(const T* pData, size_t uCount) {
+				CheckOpen();
+
+				size_t uSize = size();
+
+				if (uSize + uCount > m_uCapacity) {
+					// The elements may be this vector's own, which growing may move
+					bool   bOwn	   = pData >= data() && pData < data() + uSize;
+					size_t uOffset = bOwn ? (size_t)(pData - data()) : 0;
+
+					ReAlloc(uSize + uCount > m_uCapacity + m_uCapacity / 2 ? uSize + uCount : m_uCapacity + m_uCapacity / 2);
+
+					if (bOwn)
+						pData = data() + uOffset;
+				}
+
+				std::memcpy(data() + uSize, pData, uCount * sizeof(T));
+				Header()->uCount = uSize + uCount;
+			}
+
+			// If there are any elements, drops the last one
+			void pop_back() {
+				if (!empty())
+					Header()->uCount--;
+			}
+
+			// Resizes the container. If necessary, grows the file to a proper size
+			void resize(size_t uNewSize, const T& value = T{}) {
+				CheckOpen();
+
+				size_t uSize = size();
+
+				if (uNewSize > m_uCapacity)
+					ReAlloc(uNewSize);
+
+				for (size_t i = uSize; i < uNewSize; ++i)
+					new(data() + i) T(value);
+
+				Header()->uCount = uNewSize;
+			}
+
+			// Swaps with the given container, neither file is touched
+			void swap(PersistentVector& other) {
+				if (this == &other)
+					return;
+
+				std::swap(m_File,	   other.m_File);
+				std::swap(m_uCapacity, other.m_uCapacity);
+			}
+
+		private:
+			detail::BinaryHeader* Header() {
+				return reinterpret_cast<detail::BinaryHeader*>(m_File.data());
+			}
+
+			const detail::BinaryHeader* Header() const {
+				return reinterpret_cast<const detail::BinaryHeader*>(m_File.data());
+			}
+
+			// Modifying a closed vector is a usage error, there is no file to modify
+			void CheckOpen() const {
+				if (!is_open())
+					throw std::logic_error("The vector isn't open");
+			}
+
+			// Resizes the file and its mapping to fit uNewCap elements. Throws std::bad_alloc if the file can't grow,
+			// and std::logic_error if the vector isn't open
+			void ReAlloc(size_t uNewCap) {
+				CheckOpen();
+
+				if (!m_File.resize(sizeof(detail::BinaryHeader) + uNewCap * sizeof(T)))
+					throw std::bad_alloc();
+
+				m_uCapacity = uNewCap;
+			}
+
+		private:
+			// Capacity added on top of the usual 1.5x growth, so that small vectors don't remap the file for every few elements
+			static constexpr size_t MIN_GROWTH = 4096 / sizeof(T) + 1;
+
+		private:
+			MappedFile m_File;
+			size_t	   m_uCapacity = 0;
+	};
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <new>
+#include <memory>
+#include <string>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+#include "BinaryFile.hpp"
+#include "../Containers/List.hpp"
+#include "../Containers/Array.hpp"
+#include "../Containers/Vector.hpp"
+
+// Saving and loading containers of trivially copyable elements as binary files, look for: BinaryWriter, BinaryReader.
+// Kept out of the containers themselves, so only the code doing file I/O pulls in the platform headers it needs
+namespace nstd {
+	// Writes the elements of vec to the file at pPath as one block after a header.
+	// Returns false if the file couldn't be written
+	template<typename T, typename Alloc>
+	bool save(const Vector<T, Alloc>& vec, const char* pPath) {
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be saved as bytes");
+
+		BinaryWriter writer;
+
+		return writer.open(pPath, sizeof(T)) && writer.write(vec.data(), vec.size()) && writer.close();
+	}
+
+	// Replaces the elements of vec with the ones saved to the file at pPath, allocating for all of them at once.
+	// Returns false, leaving vec as it was, if the file can't be read, was saved for a different T or fails its checksum.
+	// Where the file can be memory mapped the elements are copied straight from the mapping, otherwise they are read
+	// over default constructed ones
+	template<typename T, typename Alloc>
+	bool load(Vector<T, Alloc>& vec, const char* pPath) {
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be loaded from bytes");
+
+		BinaryReader reader;
+
+		if (!reader.open(pPath, sizeof(T)))
+			return false;
+
+		size_t uCount = reader.count();
+
+		if (const T* pData = static_cast<const T*>(reader.view(uCount))) {
+			if (!reader.intact())
+				return false;
+
+			vec = Vector<T, Alloc>(pData, pData + uCount);
+
+			return reader.close();
+		}
+
+		Vector<T, Alloc> loaded;
+
+		loaded.resize(uCount);
+
+		if (!reader.read(loaded.data(), uCount) || !reader.close())
+			return false;
+
+		vec = std::move(loaded);
+
+		return true;
+	}
+
+	// Writes the elements of arr to the file at pPath as one block after a header
+	template<typename T, size_t _Size>
+	bool save(const Array<T, _Size>& arr, const char* pPath) {
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be saved as bytes");
+
+		BinaryWriter writer;
+
+		return writer.open(pPath, sizeof(T)) && writer.write(arr.data(), _Size) && writer.close();
+	}
+
+	// Overwrites the elements of arr with the ones saved to the file at pPath. Returns false, leaving arr as it was,
+	// if the file can't be read, doesn't hold exactly _Size elements of T or fails its checksum
+	template<typename T, size_t _Size>
+	bool load(Array<T, _Size>& arr, const char* pPath) {
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be loaded from bytes");
+
+		BinaryReader reader;
+
+		if (!reader.open(pPath, sizeof(T)) || reader.count() != _Size)
+			return false;
+
+		if (const void* pData = reader.view(_Size)) {
+			if (!reader.intact())
+				return false;
+
+			std::memcpy(arr.data(), pData, sizeof(T) * _Size);
+
+			return reader.close();
+		}
+
+		std::unique_ptr<unsigned char[]> pBuffer(new unsigned char[sizeof(T) * _Size]);
+
+		if (!reader.read(pBuffer.get(), _Size) || !reader.close())
+			return false;
+
+		std::memcpy(arr.data(), pBuffer.get(), sizeof(T) * _Size);
+
+		return true;
+	}
+
+	// Writes the elements of list to the file at pPath after a header. Elements are gathered into large blocks,
+	// so the file is written in a few big calls
+	template<typename T>
+	bool save(const List<T>& list, const char* pPath) {
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be saved as bytes");
+
+		BinaryWriter writer;
+
+		if (!writer.open(pPath, sizeof(T)))
+			return false;
+
+		for (const T& element : list)
+			writer.write(&element, 1);
+
+		return writer.close();
+	}
+
+	// Appends the elements saved to the file at pPath to list. Returns false, leaving list as it was, if the file
+	// can't be read, was saved for a different T or fails its checksum. Where the file can be memory mapped the
+	// nodes are built straight from the mapping, otherwise it is read in large blocks. Either way the count is
+	// known up front, so the nodes come from chunks right away, look for: List::append_range
+	template<typename T>
+	bool load(List<T>& list, const char* pPath) {
+		static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable elements can be loaded from bytes");
+
+		BinaryReader reader;
+
+		if (!reader.open(pPath, sizeof(T)))
+			return false;
+
+		size_t	uCount = reader.count();
+		List<T> loaded;
+
+		if (const T* pData = static_cast<const T*>(reader.view(uCount))) {
+			loaded.append_range(pData, pData + uCount);
+		}
+		else {
+			struct alignas(T) Slot { unsigned char Bytes[sizeof(T)]; };
+
+			size_t					uBlock = detail::BINARY_BLOCK_BYTES / sizeof(T) + 1;
+			std::unique_ptr<Slot[]> pBuffer(new Slot[uBlock]);
+
+			for (size_t uLeft = uCount; uLeft > 0;) {
+				size_t uTaken = uLeft < uBlock ? uLeft : uBlock;
+
+				if (!reader.read(pBuffer.get(), uTaken))
+					return false;
+
+				const T* pFirst = std::launder(reinterpret_cast<const T*>(pBuffer.get()));
+
+				loaded.append_range(pFirst, pFirst + uTaken);
+				uLeft -= uTaken;
+			}
+		}
+
+		if (!reader.close())
+			return false;
+
+		list.splice(list.cend(), loaded);
+
+		return true;
+	}
+}
+
+// Kept for the code that used to do I/O through the List members, look for: nstd::load and nstd::save
+template<typename T>
+bool List<T>::read_from_binary_file(const std::string& filename)
+{
+	return nstd::load(*this, filename.c_str());
+}
+
+template<typename T>
+bool List<T>::write_to_binary_file(const std::string& filename)
+{
+	return nstd::save(*this, filename.c_str());
+}
\ No newline at end of file
@@ -1,18 +1,29 @@
 #pragma once
 
+#include <new>
+#include <limits>
+#include <memory>
+#include <cstddef>
+#include <utility>
+
 namespace nstd {
 	template<typename T>
 	class Allocator {
 		public:
+			// Allocator type for other element types, used by containers storing more than one kind of object
+			template<typename U>
+			struct rebind {
+				using other = Allocator<U>;
+			};
 
 			// Returns an address of an obj even if the operator& is overloaded
 			T* address(T& obj) const {
-				return addressof(obj);
+				return std::addressof(obj);
 			}
 
 			// Returns a const address of an obj even if the operator& is overloaded
 			const T* address(const T& obj) const {
-				return addressof(obj);
+				return std::addressof(obj);
 			}
 
 			// Allocates uSize space in memory without initializing it
@@ -33,16 +44,11 @@ namespace nstd {
 			// Allocates uSize space in memory, as close to the pHint as possible, without initializing it
 			// If allocation fails, throws std::bad_alloc
 			// If impossible to allocate, throws std::bad_array_new_length
+			// The global operator new takes no locality hint, so the hint is ignored
 			T* allocate(size_t uSize, const void* pHint) {
-				T* pPtr = (T*)::operator new(uSize * sizeof(T), pHint);
-
-				if (!pPtr)
-					throw std::bad_alloc();
-
-				if (std::numeric_limits<size_t>::max() / sizeof(T) < uSize)
-					throw std::bad_array_new_length();
+				(void)pHint;
 
-				return pPtr;
+				return allocate(uSize);
 			}
 
 			// Deallocates memory with given size uSize, at pPtr
@@ -71,6 +77,11 @@ namespace nstd {
 				pPtr->~T();
 			}
 
+			// Stateless, so memory allocated by any instance can be deallocated by any other
+			bool operator ==(const Allocator&) const {
+				return true;
+			}
+
 			// Static methods
 			static T* allocate(Allocator& alloc, size_t uSize) {
 				return alloc.allocate(uSize);
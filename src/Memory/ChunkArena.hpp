@@ -0,0 +1,156 @@
+#pragma once
+
+#include <new>
+#include <atomic>
+#include <limits>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace nstd {
+	namespace detail {
+		// Chunks are aligned to their size, so a block finds the header of its chunk by masking its address
+		constexpr size_t ARENA_CHUNK_BYTES = 64 * 1024;
+
+		// Counts the blocks still handed out from a chunk, plus one while the arena keeps carving it
+		struct ArenaChunk {
+			std::atomic<size_t> uLive;
+		};
+
+		inline void ReleaseArenaChunk(ArenaChunk* pChunk) {
+			if (pChunk->uLive.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+				pChunk->~ArenaChunk();
+				::operator delete(pChunk, std::align_val_t(ARENA_CHUNK_BYTES));
+			}
+		}
+	}
+
+	// Hands out memory for a batch of objects built together by bumping a pointer through 64 KiB chunks, so they end
+	// up next to each other and cost no trip through the general purpose heap each. Blocks are never reused:
+	// deallocating one only decrements its chunk's count, and the whole chunk is freed at once when its last block
+	// goes. That count is atomic, so blocks may be freed from any thread and long after the arena itself is gone.
+	// Meant for bulk loads of objects that mostly die together, a chunk stays around as long as any of its blocks
+	class ChunkArena {
+		public:
+			// A block plus its alignment can't take up more than a chunk
+			static constexpr bool fits(size_t uSize, size_t uAlignment) {
+				return uSize + uAlignment <= detail::ARENA_CHUNK_BYTES;
+			}
+
+			// How many blocks of uSize bytes aligned to uAlignment one chunk holds, 0 if they don't fit at all
+			static constexpr size_t capacity(size_t uSize, size_t uAlignment) {
+				size_t uStride = (uSize + uAlignment - 1) / uAlignment * uAlignment;
+				size_t uFirst  = (sizeof(detail::ArenaChunk) + uAlignment - 1) / uAlignment * uAlignment;
+
+				return fits(uSize, uAlignment) ? (detail::ARENA_CHUNK_BYTES - uFirst) / uStride : 0;
+			}
+
+		public:
+			ChunkArena() = default;
+
+			ChunkArena(const ChunkArena&) = delete;
+			ChunkArena& operator =(const ChunkArena&) = delete;
+
+			// Blocks already handed out stay valid
+			~ChunkArena() {
+				if (m_pChunk)
+					detail::ReleaseArenaChunk(m_pChunk);
+			}
+
+			// Returns uSize bytes aligned to uAlignment, starting a new chunk when the current one is full.
+			// The block has to fit into a chunk
+			void* allocate(size_t uSize, size_t uAlignment) {
+				uintptr_t uStart = (m_uCursor + uAlignment - 1) & ~(uintptr_t)(uAlignment - 1);
+
+				if (!m_pChunk || uStart + uSize > m_uEnd) {
+					NewChunk();
+					uStart = (m_uCursor + uAlignment - 1) & ~(uintptr_t)(uAlignment - 1);
+				}
+
+				m_uCursor = uStart + uSize;
+				m_pChunk->uLive.fetch_add(1, std::memory_order_relaxed);
+
+				return reinterpret_cast<void*>(uStart);
+			}
+
+			// Gives back a block allocated by any arena
+			static void deallocate(void* pPtr) {
+				uintptr_t uChunk = reinterpret_cast<uintptr_t>(pPtr) & ~(uintptr_t)(detail::ARENA_CHUNK_BYTES - 1);
+
+				detail::ReleaseArenaChunk(reinterpret_cast<detail::ArenaChunk*>(uChunk));
+			}
+
+		private:
+			void NewChunk() {
+				void* pMemory = ::operator new(detail::ARENA_CHUNK_BYTES, std::align_val_t(detail::ARENA_CHUNK_BYTES));
+
+				if (m_pChunk)
+					detail::ReleaseArenaChunk(m_pChunk);
+
+				m_pChunk  = new(pMemory) detail::ArenaChunk{ { 1 } };
+				m_uCursor = reinterpret_cast<uintptr_t>(pMemory) + sizeof(detail::ArenaChunk);
+				m_uEnd	  = reinterpret_cast<uintptr_t>(pMemory) + detail::ARENA_CHUNK_BYTES;
+			}
+
+		private:
+			detail::ArenaChunk* m_pChunk  = nullptr;
+			uintptr_t			m_uCursor = 0;
+			uintptr_t			m_uEnd	  = 0;
+	};
+
+	// Allocator carving single objects out of a ChunkArena, usable with std::allocate_shared. Arrays and objects
+	// too large for a chunk go to the global heap instead. Deallocation needs no arena, so the copies kept by
+	// shared_ptr control blocks may outlive the arena they were made from
+	template<typename T>
+	class ArenaAllocator {
+		public:
+			using value_type = T;
+
+			template<typename U>
+			struct rebind {
+				using other = ArenaAllocator<U>;
+			};
+
+		public:
+			explicit ArenaAllocator(ChunkArena& arena)
+				: m_pArena(&arena) { }
+
+			template<typename U>
+			ArenaAllocator(const ArenaAllocator<U>& other)
+				: m_pArena(other.m_pArena) { }
+
+			// If allocation fails, throws std::bad_alloc
+			// If impossible to allocate, throws std::bad_array_new_length
+			T* allocate(size_t uSize) {
+				if (uSize == 1 && FITS_CHUNK)
+					return static_cast<T*>(m_pArena->allocate(sizeof(T), alignof(T)));
+
+				if (std::numeric_limits<size_t>::max() / sizeof(T) < uSize)
+					throw std::bad_array_new_length();
+
+				return static_cast<T*>(::operator new(uSize * sizeof(T)));
+			}
+
+			void deallocate(T* pPtr, size_t uSize) {
+				if (uSize == 1 && FITS_CHUNK)
+					ChunkArena::deallocate(pPtr);
+				else
+					::operator delete(pPtr, uSize * sizeof(T));
+			}
+
+			// Any allocator can deallocate the blocks of any other
+			template<typename U>
+			bool operator ==(const ArenaAllocator<U>&) const {
+				return true;
+			}
+
+		private:
+			template<typename>
+			friend class ArenaAllocator;
+
+			static constexpr bool FITS_CHUNK = ChunkArena::fits(sizeof(T), alignof(T));
+
+		private:
+			ChunkArena* m_pArena;
+	};
+}
\ No newline at end of file
@@ -1,12 +1,50 @@
 #pragma once
 
+#include <cstddef>
+#include <type_traits>
+
 #include "Allocator.hpp"
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#define NSTD_HAS_SSE2 1
+	#include <emmintrin.h>
+#endif
+
 namespace nstd {
+	// Size of a cache line assumed by the containers that pad their shared state to avoid false sharing
+	constexpr size_t CACHE_LINE_SIZE = 64;
 
 	// Returns an address of an obj even if the operator& is overloaded
 	template<typename T>
 	T* addressof(const T& obj) {
 		return reinterpret_cast<T*>(&const_cast<char&>(reinterpret_cast<const volatile char&>(obj)));
 	}
+
+	// Hints the CPU to start loading the cache line holding pPtr, for data that will be read soon.
+	// Never faults, so it may be given addresses past the end of an allocation
+	inline void prefetch(const void* pPtr) {
+	#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(pPtr);
+	#elif defined(NSTD_HAS_SSE2)
+		_mm_prefetch(static_cast<const char*>(pPtr), _MM_HINT_T0);
+	#else
+		(void)pPtr;
+	#endif
+	}
+
+	// Returns the object whose pMember field lives at pField, for intrusive containers that only link the fields.
+	// Pointers to members can't go through offsetof, so the offset is measured on scratch storage that is never
+	// touched, which optimizers fold into a constant. A pointer to a data member always stands for a fixed offset:
+	// the language doesn't convert pointers to members of a virtual base into pointers to members of the derived
+	// class, so any class can be an owner, private members and virtual functions included
+	template<typename Owner, typename Member>
+	Owner* owner_of(Member* pField, Member Owner::*pMember) {
+		static_assert(std::is_class_v<Owner>, "Only fields of classes have owners");
+
+		alignas(Owner) unsigned char scratch[sizeof(Owner)];
+
+		size_t uOffset = reinterpret_cast<unsigned char*>(&(reinterpret_cast<Owner*>(scratch)->*pMember)) - scratch;
+
+		return reinterpret_cast<Owner*>(reinterpret_cast<unsigned char*>(pField) - uOffset);
+	}
 }
\ No newline at end of file
@@ -0,0 +1,187 @@
+#pragma once
+
+#include <new>
+#include <limits>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+#include "Memory.hpp"
+
+namespace nstd {
+	// Allocator handing out single objects from chunks of equally sized blocks. Freed blocks go onto a free list
+	// and are reused by the next allocation, so node based containers pay a pointer pop instead of a trip through
+	// the general purpose heap per node, and nodes carry no per-allocation header. Chunks start at
+	// FIRST_CHUNK_BLOCKS blocks and double up to MAX_CHUNK_BLOCKS, and are all released when the allocator dies.
+	// Allocations of more than one object are passed through to the global operator new.
+	// Every instance owns its own pool: copies start out empty, moves take the chunks along, and instances only
+	// compare equal to themselves. Containers have to move their allocator together with their nodes and must not
+	// hand nodes to a container with an unequal allocator
+	template<typename T>
+	class PoolAllocator {
+		public:
+			template<typename U>
+			struct rebind {
+				using other = PoolAllocator<U>;
+			};
+
+			static constexpr size_t FIRST_CHUNK_BLOCKS = 32;
+			static constexpr size_t MAX_CHUNK_BLOCKS   = 4096;
+
+		private:
+			// A free block stores the link to the next free one
+			union Block {
+				Block* pNext;
+				alignas(T) unsigned char Storage[sizeof(T)];
+			};
+
+			// Chunks are linked through a header in front of their blocks
+			struct Chunk {
+				Chunk* pNext;
+			};
+
+			static constexpr size_t HEADER_SIZE		= (sizeof(Chunk) + alignof(Block) - 1) / alignof(Block) * alignof(Block);
+			static constexpr size_t CHUNK_ALIGNMENT = std::max(alignof(Block), alignof(Chunk));
+
+		public:
+			PoolAllocator() = default;
+
+			PoolAllocator(const PoolAllocator&) noexcept { }
+
+			template<typename U>
+			PoolAllocator(const PoolAllocator<U>&) noexcept { }
+
+			PoolAllocator(PoolAllocator&& other) noexcept {
+				*this = std::move(other);
+			}
+
+			// Every block has to be deallocated by now
+			~PoolAllocator() {
+				Release();
+			}
+
+			// Keeps its own pool
+			PoolAllocator& operator =(const PoolAllocator&) noexcept {
+				return *this;
+			}
+
+			// Releases its own chunks, which must hold no live blocks, and takes over those of the other allocator
+			PoolAllocator& operator =(PoolAllocator&& other) noexcept {
+				if (this == &other)
+					return *this;
+
+				Release();
+
+				m_pFree		  = std::exchange(other.m_pFree, nullptr);
+				m_pChunks	  = std::exchange(other.m_pChunks, nullptr);
+				m_uNextBlocks = std::exchange(other.m_uNextBlocks, FIRST_CHUNK_BLOCKS);
+
+				return *this;
+			}
+
+			// Returns an address of an obj even if the operator& is overloaded
+			T* address(T& obj) const {
+				return addressof(obj);
+			}
+
+			const T* address(const T& obj) const {
+				return addressof(obj);
+			}
+
+			// Takes a block off the free list, allocating a new chunk when it is empty.
+			// If allocation fails, throws std::bad_alloc
+			// If impossible to allocate, throws std::bad_array_new_length
+			T* allocate(size_t uSize) {
+				if (uSize != 1) {
+					if (std::numeric_limits<size_t>::max() / sizeof(T) < uSize)
+						throw std::bad_array_new_length();
+
+					return (T*)::operator new(uSize * sizeof(T));
+				}
+
+				if (!m_pFree)
+					Grow();
+
+				Block* pBlock = m_pFree;
+
+				m_pFree = pBlock->pNext;
+
+				return reinterpret_cast<T*>(pBlock);
+			}
+
+			// Pools don't take locality hints, so the hint is ignored
+			T* allocate(size_t uSize, const void* pHint) {
+				(void)pHint;
+
+				return allocate(uSize);
+			}
+
+			// Puts a single block back onto the free list, larger allocations go back to the global heap
+			void deallocate(void* pPtr, size_t uSize) {
+				if (uSize != 1) {
+					::operator delete(pPtr, uSize * sizeof(T));
+
+					return;
+				}
+
+				Block* pBlock = static_cast<Block*>(pPtr);
+
+				pBlock->pNext = m_pFree;
+				m_pFree		  = pBlock;
+			}
+
+			size_t max_size() const {
+				return std::numeric_limits<size_t>::max() / sizeof(T);
+			}
+
+			template<typename... Args>
+			void construct(T* pPtr, Args&&... args) {
+				new(pPtr) T(std::forward<Args>(args)...);
+			}
+
+			void destroy(T* pPtr) {
+				pPtr->~T();
+			}
+
+			// Memory from one pool can only go back to the same pool
+			bool operator ==(const PoolAllocator& other) const {
+				return this == &other;
+			}
+
+		private:
+			// Allocates the next chunk and threads its blocks onto the free list
+			void Grow() {
+				size_t uBlocks = m_uNextBlocks;
+				char*  pMemory = static_cast<char*>(::operator new(HEADER_SIZE + uBlocks * sizeof(Block), std::align_val_t(CHUNK_ALIGNMENT)));
+				Chunk* pChunk  = reinterpret_cast<Chunk*>(pMemory);
+				Block* pBlocks = reinterpret_cast<Block*>(pMemory + HEADER_SIZE);
+
+				pChunk->pNext = m_pChunks;
+				m_pChunks	  = pChunk;
+
+				for (size_t i = 0; i + 1 < uBlocks; ++i)
+					pBlocks[i].pNext = &pBlocks[i + 1];
+
+				pBlocks[uBlocks - 1].pNext = m_pFree;
+				m_pFree					   = pBlocks;
+				m_uNextBlocks			   = std::min(uBlocks * 2, MAX_CHUNK_BLOCKS);
+			}
+
+			void Release() {
+				while (m_pChunks) {
+					Chunk* pNext = m_pChunks->pNext;
+
+					::operator delete(m_pChunks, std::align_val_t(CHUNK_ALIGNMENT));
+					m_pChunks = pNext;
+				}
+
+				m_pFree		  = nullptr;
+				m_uNextBlocks = FIRST_CHUNK_BLOCKS;
+			}
+
+		private:
+			Block* m_pFree		 = nullptr;
+			Chunk* m_pChunks	 = nullptr;
+			size_t m_uNextBlocks = FIRST_CHUNK_BLOCKS;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,722 @@
+#pragma once
+
+#include <tuple>
+#include <utility>
+#include <iterator>
+#include <type_traits>
+
+namespace nstd {
+	// Every view derives from this, views are cheap to copy and get stored by value inside other views
+	class ViewBase { };
+
+	template<typename Range>
+	using RangeIterator = decltype(std::declval<Range&>().begin());
+
+	template<typename Range>
+	using RangeReference = decltype(*std::declval<RangeIterator<Range>&>());
+
+	namespace detail {
+		template<typename T>
+		constexpr bool IsView = std::is_base_of_v<ViewBase, std::remove_cv_t<std::remove_reference_t<T>>>;
+
+		// Advances itr by at most uCount steps, stopping at end
+		template<typename Itr>
+		void Advance(Itr& itr, const Itr& end, size_t uCount) {
+			while (uCount-- && itr != end)
+				++itr;
+		}
+	}
+
+	// Pair of iterators viewed as a range
+	template<typename Itr>
+	class Subrange : public ViewBase {
+		public:
+			Subrange(Itr first, Itr last)
+				: m_First(first), m_Last(last) { }
+
+			Itr begin() const {
+				return m_First;
+			}
+
+			Itr end() const {
+				return m_Last;
+			}
+
+			bool empty() const {
+				return !(m_First != m_Last);
+			}
+
+		private:
+			Itr m_First;
+			Itr m_Last;
+	};
+
+	// Views an lvalue container without copying it, the container has to outlive the view
+	template<typename Range>
+	class RefView : public ViewBase {
+		public:
+			RefView(Range& range)
+				: m_pRange(&range) { }
+
+			RangeIterator<Range> begin() const {
+				return m_pRange->begin();
+			}
+
+			RangeIterator<Range> end() const {
+				return m_pRange->end();
+			}
+
+		private:
+			Range* m_pRange;
+	};
+
+	// Takes ownership of a temporary container, so pipelines starting from one don't dangle
+	template<typename Range>
+	class OwningView : public ViewBase {
+		public:
+			OwningView(Range&& range)
+				: m_Range(std::move(range)) { }
+
+			RangeIterator<Range> begin() {
+				return m_Range.begin();
+			}
+
+			RangeIterator<Range> end() {
+				return m_Range.end();
+			}
+
+		private:
+			Range m_Range;
+	};
+
+	// Turns anything iterable into a view: views are copied, lvalues referenced, temporaries moved in
+	template<typename Range>
+	auto all(Range&& range) {
+		if constexpr (detail::IsView<Range>)
+			return std::decay_t<Range>(std::forward<Range>(range));
+		else if constexpr (std::is_lvalue_reference_v<Range>)
+			return RefView<std::remove_reference_t<Range>>(range);
+		else
+			return OwningView<std::decay_t<Range>>(std::move(range));
+	}
+
+	template<typename Range>
+	using AllView = decltype(all(std::declval<Range>()));
+
+	// Elements of the underlying view satisfying the predicate
+	template<typename View, typename Pred>
+	class FilterView : public ViewBase {
+		public:
+			using BaseIterator = RangeIterator<View>;
+
+			class Iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using value_type		= std::remove_cv_t<std::remove_reference_t<RangeReference<View>>>;
+					using reference			= RangeReference<View>;
+					using pointer			= void;
+
+				public:
+					Iterator(BaseIterator itr, BaseIterator end, const Pred* pPred)
+						: m_Itr(itr), m_End(end), m_pPred(pPred) {
+						SkipRejected();
+					}
+
+					Iterator& operator ++() {
+						++m_Itr;
+						SkipRejected();
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return *m_Itr;
+					}
+
+					bool operator ==(const Iterator& other) const {
+						return m_Itr == other.m_Itr;
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return m_Itr != other.m_Itr;
+					}
+
+				private:
+					void SkipRejected() {
+						while (m_Itr != m_End && !(*m_pPred)(*m_Itr))
+							++m_Itr;
+					}
+
+				private:
+					BaseIterator m_Itr;
+					BaseIterator m_End;
+					const Pred*	 m_pPred;
+			};
+
+		public:
+			FilterView(View base, Pred pred)
+				: m_Base(std::move(base)), m_Pred(std::move(pred)) { }
+
+			Iterator begin() {
+				return Iterator(m_Base.begin(), m_Base.end(), &m_Pred);
+			}
+
+			Iterator end() {
+				return Iterator(m_Base.end(), m_Base.end(), &m_Pred);
+			}
+
+		private:
+			View m_Base;
+			Pred m_Pred;
+	};
+
+	// func(element) of every element of the underlying view, computed on access
+	template<typename View, typename Func>
+	class TransformView : public ViewBase {
+		public:
+			using BaseIterator = RangeIterator<View>;
+
+			class Iterator {
+				public:
+					using iterator_category = std::input_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using reference			= decltype(std::declval<const Func&>()(std::declval<RangeReference<View>>()));
+					using value_type		= std::remove_cv_t<std::remove_reference_t<reference>>;
+					using pointer			= void;
+
+				public:
+					Iterator(BaseIterator itr, const Func* pFunc)
+						: m_Itr(itr), m_pFunc(pFunc) { }
+
+					Iterator& operator ++() {
+						++m_Itr;
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return (*m_pFunc)(*m_Itr);
+					}
+
+					bool operator ==(const Iterator& other) const {
+						return m_Itr == other.m_Itr;
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return m_Itr != other.m_Itr;
+					}
+
+				private:
+					BaseIterator m_Itr;
+					const Func*	 m_pFunc;
+			};
+
+		public:
+			TransformView(View base, Func func)
+				: m_Base(std::move(base)), m_Func(std::move(func)) { }
+
+			Iterator begin() {
+				return Iterator(m_Base.begin(), &m_Func);
+			}
+
+			Iterator end() {
+				return Iterator(m_Base.end(), &m_Func);
+			}
+
+		private:
+			View m_Base;
+			Func m_Func;
+	};
+
+	// At most the first uCount elements of the underlying view
+	template<typename View>
+	class TakeView : public ViewBase {
+		public:
+			using BaseIterator = RangeIterator<View>;
+
+			class Iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using value_type		= std::remove_cv_t<std::remove_reference_t<RangeReference<View>>>;
+					using reference			= RangeReference<View>;
+					using pointer			= void;
+
+				public:
+					Iterator(BaseIterator itr, BaseIterator end, size_t uRemaining)
+						: m_Itr(itr), m_End(end), m_uRemaining(uRemaining) { }
+
+					Iterator& operator ++() {
+						++m_Itr;
+						--m_uRemaining;
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return *m_Itr;
+					}
+
+					// Every exhausted iterator is equal to end(), whichever limit it hit
+					bool operator ==(const Iterator& other) const {
+						if (Done() || other.Done())
+							return Done() && other.Done();
+
+						return m_Itr == other.m_Itr;
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return !(*this == other);
+					}
+
+				private:
+					bool Done() const {
+						return m_uRemaining == 0 || m_Itr == m_End;
+					}
+
+				private:
+					BaseIterator m_Itr;
+					BaseIterator m_End;
+					size_t		 m_uRemaining;
+			};
+
+		public:
+			TakeView(View base, size_t uCount)
+				: m_Base(std::move(base)), m_uCount(uCount) { }
+
+			Iterator begin() {
+				return Iterator(m_Base.begin(), m_Base.end(), m_uCount);
+			}
+
+			Iterator end() {
+				return Iterator(m_Base.end(), m_Base.end(), 0);
+			}
+
+		private:
+			View   m_Base;
+			size_t m_uCount;
+	};
+
+	// Everything but the first uCount elements of the underlying view
+	template<typename View>
+	class DropView : public ViewBase {
+		public:
+			DropView(View base, size_t uCount)
+				: m_Base(std::move(base)), m_uCount(uCount) { }
+
+			RangeIterator<View> begin() {
+				RangeIterator<View> itr = m_Base.begin();
+
+				detail::Advance(itr, m_Base.end(), m_uCount);
+
+				return itr;
+			}
+
+			RangeIterator<View> end() {
+				return m_Base.end();
+			}
+
+		private:
+			View   m_Base;
+			size_t m_uCount;
+	};
+
+	// Consecutive Subranges of uSize elements of the underlying view, the last one may be shorter
+	template<typename View>
+	class ChunkView : public ViewBase {
+		public:
+			using BaseIterator = RangeIterator<View>;
+
+			class Iterator {
+				public:
+					using iterator_category = std::input_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using value_type		= Subrange<BaseIterator>;
+					using reference			= Subrange<BaseIterator>;
+					using pointer			= void;
+
+				public:
+					Iterator(BaseIterator itr, BaseIterator end, size_t uSize)
+						: m_Itr(itr), m_Next(itr), m_End(end), m_uSize(uSize) {
+						detail::Advance(m_Next, m_End, m_uSize);
+					}
+
+					Iterator& operator ++() {
+						m_Itr = m_Next;
+						detail::Advance(m_Next, m_End, m_uSize);
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return Subrange<BaseIterator>(m_Itr, m_Next);
+					}
+
+					bool operator ==(const Iterator& other) const {
+						return m_Itr == other.m_Itr;
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return m_Itr != other.m_Itr;
+					}
+
+				private:
+					BaseIterator m_Itr;
+					BaseIterator m_Next;
+					BaseIterator m_End;
+					size_t		 m_uSize;
+			};
+
+		public:
+			ChunkView(View base, size_t uSize)
+				: m_Base(std::move(base)), m_uSize(uSize ? uSize : 1) { }
+
+			Iterator begin() {
+				return Iterator(m_Base.begin(), m_Base.end(), m_uSize);
+			}
+
+			Iterator end() {
+				return Iterator(m_Base.end(), m_Base.end(), m_uSize);
+			}
+
+		private:
+			View   m_Base;
+			size_t m_uSize;
+	};
+
+	// Every uStep-th element of the underlying view, starting with the first one
+	template<typename View>
+	class StrideView : public ViewBase {
+		public:
+			using BaseIterator = RangeIterator<View>;
+
+			class Iterator {
+				public:
+					using iterator_category = std::forward_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using value_type		= std::remove_cv_t<std::remove_reference_t<RangeReference<View>>>;
+					using reference			= RangeReference<View>;
+					using pointer			= void;
+
+				public:
+					Iterator(BaseIterator itr, BaseIterator end, size_t uStep)
+						: m_Itr(itr), m_End(end), m_uStep(uStep) { }
+
+					Iterator& operator ++() {
+						detail::Advance(m_Itr, m_End, m_uStep);
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return *m_Itr;
+					}
+
+					bool operator ==(const Iterator& other) const {
+						return m_Itr == other.m_Itr;
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return m_Itr != other.m_Itr;
+					}
+
+				private:
+					BaseIterator m_Itr;
+					BaseIterator m_End;
+					size_t		 m_uStep;
+			};
+
+		public:
+			StrideView(View base, size_t uStep)
+				: m_Base(std::move(base)), m_uStep(uStep ? uStep : 1) { }
+
+			Iterator begin() {
+				return Iterator(m_Base.begin(), m_Base.end(), m_uStep);
+			}
+
+			Iterator end() {
+				return Iterator(m_Base.end(), m_Base.end(), m_uStep);
+			}
+
+		private:
+			View   m_Base;
+			size_t m_uStep;
+	};
+
+	// Tuples of references to the i-th elements of every underlying view, as long as the shortest one
+	template<typename... Views>
+	class ZipView : public ViewBase {
+		public:
+			class Iterator {
+				public:
+					using iterator_category = std::input_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using value_type		= std::tuple<std::remove_cv_t<std::remove_reference_t<RangeReference<Views>>>...>;
+					using reference			= std::tuple<RangeReference<Views>...>;
+					using pointer			= void;
+
+				public:
+					Iterator(std::tuple<RangeIterator<Views>...> itrs)
+						: m_Itrs(std::move(itrs)) { }
+
+					Iterator& operator ++() {
+						std::apply([](auto&... itrs) { (++itrs, ...); }, m_Itrs);
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return std::apply([](const auto&... itrs) { return reference(*itrs...); }, m_Itrs);
+					}
+
+					// Equal as soon as any of the underlying iterators is, so iteration stops at the end of the shortest view
+					bool operator ==(const Iterator& other) const {
+						return AnyEqual(other, std::index_sequence_for<Views...>());
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return !(*this == other);
+					}
+
+				private:
+					template<size_t... I>
+					bool AnyEqual(const Iterator& other, std::index_sequence<I...>) const {
+						return ((std::get<I>(m_Itrs) == std::get<I>(other.m_Itrs)) || ...);
+					}
+
+				private:
+					std::tuple<RangeIterator<Views>...> m_Itrs;
+			};
+
+		public:
+			ZipView(Views... bases)
+				: m_Bases(std::move(bases)...) { }
+
+			Iterator begin() {
+				return Iterator(std::apply([](auto&... bases) { return std::make_tuple(bases.begin()...); }, m_Bases));
+			}
+
+			Iterator end() {
+				return Iterator(std::apply([](auto&... bases) { return std::make_tuple(bases.end()...); }, m_Bases));
+			}
+
+		private:
+			std::tuple<Views...> m_Bases;
+	};
+
+	// (index, element reference) pairs of the underlying view
+	template<typename View>
+	class EnumerateView : public ViewBase {
+		public:
+			using BaseIterator = RangeIterator<View>;
+
+			class Iterator {
+				public:
+					using iterator_category = std::input_iterator_tag;
+					using difference_type	= ptrdiff_t;
+					using value_type		= std::pair<size_t, std::remove_cv_t<std::remove_reference_t<RangeReference<View>>>>;
+					using reference			= std::pair<size_t, RangeReference<View>>;
+					using pointer			= void;
+
+				public:
+					Iterator(BaseIterator itr, size_t uIndex)
+						: m_Itr(itr), m_uIndex(uIndex) { }
+
+					Iterator& operator ++() {
+						++m_Itr;
+						++m_uIndex;
+
+						return *this;
+					}
+
+					Iterator operator ++(int) {
+						Iterator itr = *this;
+
+						++(*this);
+
+						return itr;
+					}
+
+					reference operator *() const {
+						return reference(m_uIndex, *m_Itr);
+					}
+
+					bool operator ==(const Iterator& other) const {
+						return m_Itr == other.m_Itr;
+					}
+
+					bool operator !=(const Iterator& other) const {
+						return m_Itr != other.m_Itr;
+					}
+
+				private:
+					BaseIterator m_Itr;
+					size_t		 m_uIndex;
+			};
+
+		public:
+			EnumerateView(View base)
+				: m_Base(std::move(base)) { }
+
+			Iterator begin() {
+				return Iterator(m_Base.begin(), 0);
+			}
+
+			Iterator end() {
+				return Iterator(m_Base.end(), 0);
+			}
+
+		private:
+			View m_Base;
+	};
+
+	// Partially applied view, range | adaptor builds the view and adaptor | adaptor composes them
+	template<typename Func>
+	class RangeAdaptor {
+		public:
+			constexpr RangeAdaptor(Func func)
+				: m_Func(std::move(func)) { }
+
+			template<typename Range>
+			auto operator ()(Range&& range) const {
+				return m_Func(std::forward<Range>(range));
+			}
+
+		private:
+			Func m_Func;
+	};
+
+	namespace detail {
+		template<typename T>
+		struct IsRangeAdaptor : std::false_type { };
+
+		template<typename Func>
+		struct IsRangeAdaptor<RangeAdaptor<Func>> : std::true_type { };
+	}
+
+	template<typename Range, typename Func, std::enable_if_t<!detail::IsRangeAdaptor<std::decay_t<Range>>::value, int> = 0>
+	auto operator |(Range&& range, const RangeAdaptor<Func>& adaptor) {
+		return adaptor(std::forward<Range>(range));
+	}
+
+	template<typename Lhs, typename Rhs>
+	auto operator |(RangeAdaptor<Lhs> lhs, RangeAdaptor<Rhs> rhs) {
+		return RangeAdaptor([lhs, rhs](auto&& range) { return rhs(lhs(std::forward<decltype(range)>(range))); });
+	}
+
+	namespace views {
+		template<typename Range, typename Pred>
+		auto filter(Range&& range, Pred pred) {
+			return FilterView<AllView<Range>, Pred>(all(std::forward<Range>(range)), std::move(pred));
+		}
+
+		template<typename Pred>
+		auto filter(Pred pred) {
+			return RangeAdaptor([pred](auto&& range) { return filter(std::forward<decltype(range)>(range), pred); });
+		}
+
+		template<typename Range, typename Func>
+		auto transform(Range&& range, Func func) {
+			return TransformView<AllView<Range>, Func>(all(std::forward<Range>(range)), std::move(func));
+		}
+
+		template<typename Func>
+		auto transform(Func func) {
+			return RangeAdaptor([func](auto&& range) { return transform(std::forward<decltype(range)>(range), func); });
+		}
+
+		template<typename Range>
+		auto take(Range&& range, size_t uCount) {
+			return TakeView<AllView<Range>>(all(std::forward<Range>(range)), uCount);
+		}
+
+		inline auto take(size_t uCount) {
+			return RangeAdaptor([uCount](auto&& range) { return take(std::forward<decltype(range)>(range), uCount); });
+		}
+
+		template<typename Range>
+		auto drop(Range&& range, size_t uCount) {
+			return DropView<AllView<Range>>(all(std::forward<Range>(range)), uCount);
+		}
+
+		inline auto drop(size_t uCount) {
+			return RangeAdaptor([uCount](auto&& range) { return drop(std::forward<decltype(range)>(range), uCount); });
+		}
+
+		template<typename Range>
+		auto chunk(Range&& range, size_t uSize) {
+			return ChunkView<AllView<Range>>(all(std::forward<Range>(range)), uSize);
+		}
+
+		inline auto chunk(size_t uSize) {
+			return RangeAdaptor([uSize](auto&& range) { return chunk(std::forward<decltype(range)>(range), uSize); });
+		}
+
+		template<typename Range>
+		auto stride(Range&& range, size_t uStep) {
+			return StrideView<AllView<Range>>(all(std::forward<Range>(range)), uStep);
+		}
+
+		inline auto stride(size_t uStep) {
+			return RangeAdaptor([uStep](auto&& range) { return stride(std::forward<decltype(range)>(range), uStep); });
+		}
+
+		template<typename... Ranges>
+		auto zip(Ranges&&... ranges) {
+			return ZipView<AllView<Ranges>...>(all(std::forward<Ranges>(ranges))...);
+		}
+
+		inline constexpr RangeAdaptor enumerate([](auto&& range) {
+			return EnumerateView<AllView<decltype(range)>>(all(std::forward<decltype(range)>(range)));
+		});
+	}
+}
\ No newline at end of file
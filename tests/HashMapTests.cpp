@@ -0,0 +1,67 @@
+// Build and run: g++ -std=c++20 HashMapTests.cpp -o HashMapTests && ./HashMapTests
+#include <cassert>
+#include <cstdint>
+#include <utility>
+#include <iostream>
+
+#include "../src/Containers/HashMap.hpp"
+
+// Hash seeded per map, as used against flooding: two maps place the same key in different slots
+struct SeededHash {
+	uint64_t uSeed = 0;
+
+	size_t operator ()(int iKey) const {
+		return (size_t)(((uint64_t)iKey ^ uSeed) * 0x9E3779B97F4A7C15ull);
+	}
+};
+
+using SeededMap = nstd::HashMap<int, int, SeededHash>;
+
+SeededMap MakeMap(uint64_t uSeed, int iCount) {
+	SeededMap map(0, SeededHash{ uSeed });
+
+	for (int i = 0; i < iCount; ++i)
+		map.insert({ i, i * 2 });
+
+	return map;
+}
+
+bool HasAll(const SeededMap& map, int iCount) {
+	for (int i = 0; i < iCount; ++i) {
+		if (!map.contains(i) || map.at(i) != i * 2)
+			return false;
+	}
+
+	return map.size() == (size_t)iCount;
+}
+
+void AssignmentKeepsHash() {
+	SeededMap source = MakeMap(0x1234567, 1000);
+
+	SeededMap copied(0, SeededHash{ 0xABCDEF });
+	copied = source;
+	assert(HasAll(copied, 1000));
+
+	SeededMap constructed(source);
+	assert(HasAll(constructed, 1000));
+
+	SeededMap moved(0, SeededHash{ 0xABCDEF });
+	moved = std::move(constructed);
+	assert(HasAll(moved, 1000));
+
+	// The moved-from map stays usable
+	constructed.insert({ 5, 10 });
+	assert(constructed.contains(5));
+
+	SeededMap swapped = MakeMap(0xFEDCBA, 10);
+	swapped.swap(moved);
+	assert(HasAll(swapped, 1000) && HasAll(moved, 10));
+}
+
+int main() {
+	AssignmentKeepsHash();
+
+	std::cout << "HashMap tests passed" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+// Build and run: g++ -std=c++20 IntrusiveListTests.cpp -o IntrusiveListTests && ./IntrusiveListTests
+#include <string>
+#include <cassert>
+#include <iostream>
+
+#include "../src/Containers/IntrusiveList.hpp"
+#include "../src/Concurrency/MpscQueue.hpp"
+
+// Like most real owners, not standard layout: private state next to the public hooks, and virtual functions
+class Connection {
+	public:
+		explicit Connection(int iId)
+			: m_iId(iId), m_Name("connection " + std::to_string(iId)) { }
+
+		virtual ~Connection() = default;
+
+		virtual int id() const {
+			return m_iId;
+		}
+
+	public:
+		nstd::ListHook		m_Hook;
+		nstd::MpscQueueHook m_QueueHook;
+
+	private:
+		int			m_iId;
+		std::string m_Name;
+};
+
+class TimedConnection : public Connection {
+	public:
+		using Connection::Connection;
+
+	public:
+		nstd::AutoUnlinkListHook m_TimerHook;
+
+	private:
+		long m_lDeadline = 0;
+};
+
+void PrivateMembers() {
+	Connection a(1), b(2), c(3);
+	nstd::IntrusiveList<Connection, &Connection::m_Hook> list;
+
+	list.push_back(a);
+	list.push_back(b);
+	list.push_front(c);
+
+	assert(list.size() == 3 && &list.front() == &c && &list.back() == &b);
+
+	int iSum = 0;
+
+	for (Connection& connection : list)
+		iSum += connection.id();
+
+	assert(iSum == 6);
+
+	list.clear();
+}
+
+void DerivedOwner() {
+	TimedConnection a(1), b(2);
+	nstd::IntrusiveList<TimedConnection, &TimedConnection::m_TimerHook> timers;
+
+	timers.push_back(a);
+	timers.push_back(b);
+
+	assert(&timers.front() == &a && &timers.back() == &b && timers.back().id() == 2);
+
+	a.m_TimerHook.unlink();
+	assert(&timers.front() == &b);
+}
+
+void QueuePrivateMembers() {
+	Connection a(1), b(2);
+	nstd::IntrusiveMpscQueue<Connection, &Connection::m_QueueHook> queue;
+
+	queue.push(&a);
+	queue.push(&b);
+
+	assert(queue.pop() == &a);
+	assert(queue.pop() == &b);
+	assert(queue.pop() == nullptr);
+}
+
+int main() {
+	PrivateMembers();
+	DerivedOwner();
+	QueuePrivateMembers();
+
+	std::cout << "IntrusiveList tests passed" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
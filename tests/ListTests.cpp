@@ -0,0 +1,169 @@
+// Build and run: g++ -std=c++20 ListTests.cpp -o ListTests && ./ListTests
+#include <new>
+#include <vector>
+#include <cstdio>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+
+#include "../src/Containers/List.hpp"
+#include "../src/IO/Serialization.hpp"
+
+// Bytes requested from the heap so far, and how many of them went to over-aligned blocks such as arena chunks
+static size_t g_AllocatedBytes = 0;
+static size_t g_AlignedBytes = 0;
+
+void* operator new(size_t size)
+{
+	g_AllocatedBytes += size;
+
+	if(void* ptr = std::malloc(size ? size : 1))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void* operator new(size_t size, std::align_val_t alignment)
+{
+	g_AllocatedBytes += size;
+	g_AlignedBytes += size;
+
+	if(void* ptr = std::aligned_alloc((size_t)alignment, (size + (size_t)alignment - 1) / (size_t)alignment * (size_t)alignment))
+		return ptr;
+
+	throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+// Walks the links, which have to agree with size() and end at the last element
+template<typename T>
+bool IsConsistent(const List<T>& list)
+{
+	size_t count = 0;
+
+	for(auto it = list.cbegin(); it != list.cend(); ++it)
+		count++;
+
+	return count == list.size() && (list.empty() || &list.back() == &list.get(list.size() - 1));
+}
+
+void LinksAfterClear()
+{
+	List<int> list{ 1, 2, 3 };
+
+	list.clear();
+	list.insert(list.cend(), 9);
+	assert(IsConsistent(list) && list.front() == 9);
+
+	list.clear();
+	list.emplace(list.cend(), 8);
+	assert(IsConsistent(list) && list.front() == 8);
+
+	List<int> other{ 4, 5, 6 };
+
+	list.clear();
+	list.splice(list.cend(), other);
+	assert(IsConsistent(list) && list.size() == 3 && list.front() == 4);
+
+	List<int> sorted{ 1, 7 };
+
+	list.clear();
+	list.merge(sorted);
+	assert(IsConsistent(list) && list.size() == 2 && list.back() == 7);
+}
+
+void ReassignNonEmpty()
+{
+	List<int> list{ 1, 2, 3 };
+
+	list = { 4, 5 };
+	assert(IsConsistent(list) && list.front() == 4 && list.back() == 5);
+
+	List<int> other{ 6, 7, 8, 9 };
+
+	list = other;
+	assert(IsConsistent(list) && list.size() == 4 && list.front() == 6);
+
+	// Enough for the nodes to come from chunks
+	std::vector<int> values(5000, 3);
+
+	list.assign(values.begin(), values.end());
+	assert(IsConsistent(list) && list.size() == 5000 && list.front() == 3);
+
+	list.append_range(other);
+	assert(IsConsistent(list) && list.size() == 5004 && list.back() == 9);
+}
+
+// Small copies mustn't take a chunk each, and large ones should fill the chunks they take
+void ArenaMemoryUse()
+{
+	List<int> small;
+
+	for(int i = 0; i < 64; ++i)
+		small.push_back(i);
+
+	std::vector<List<int>> copies(2000);
+	size_t before = g_AllocatedBytes;
+
+	for(List<int>& copy : copies)
+		copy = small;
+
+	// A node with its control block takes 64 bytes on common 64-bit targets
+	assert(g_AllocatedBytes - before <= copies.size() * small.size() * 128);
+
+	std::vector<int> values(100000, 1);
+
+	before = g_AlignedBytes;
+	List<int> large(values.begin(), values.end());
+
+	assert(g_AlignedBytes > before && g_AlignedBytes - before <= values.size() * 128);
+	assert(IsConsistent(large) && large.size() == values.size());
+}
+
+// The members that predate nstd::save and nstd::load keep working through them
+void BinaryFileMembers()
+{
+	List<int> saved{ 1, 2, 3 };
+
+	assert(saved.write_to_binary_file("ListTests.bin"));
+
+	List<int> loaded{ 0 };
+
+	assert(loaded.read_from_binary_file("ListTests.bin"));
+	assert(IsConsistent(loaded) && loaded.size() == 4 && loaded.front() == 0 && loaded.back() == 3);
+
+	std::remove("ListTests.bin");
+
+	assert(!loaded.read_from_binary_file("ListTests.bin") && loaded.size() == 4);
+}
+
+int main()
+{
+	LinksAfterClear();
+	ReassignNonEmpty();
+	ArenaMemoryUse();
+	BinaryFileMembers();
+
+	std::cout << "List tests passed" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
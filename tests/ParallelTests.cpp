@@ -0,0 +1,96 @@
+// Build and run: g++ -std=c++20 -pthread ParallelTests.cpp -o ParallelTests && ./ParallelTests
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cassert>
+#include <iostream>
+
+#include "../src/Algorithms/Parallel.hpp"
+
+// String concatenation is associative but not commutative, so any reordering of the operands shows up
+void ScansKeepOperandOrder() {
+	std::vector<std::string> in(4000);
+
+	for (size_t i = 0; i < in.size(); ++i)
+		in[i] = std::string(1, (char)('a' + i % 26));
+
+	std::vector<std::string> expected(in.size()), out(in.size());
+
+	nstd::inclusive_scan(nstd::execution::seq, in, expected);
+
+	nstd::inclusive_scan(nstd::execution::par, in, out);
+	assert(out == expected);
+
+	nstd::inclusive_scan(nstd::execution::par_unseq, in, out);
+	assert(out == expected);
+
+	nstd::exclusive_scan(nstd::execution::seq, in, expected, std::string(">"));
+	nstd::exclusive_scan(nstd::execution::par_unseq, in, out, std::string(">"));
+	assert(out == expected);
+}
+
+// Runs uCount tasks that only finish once all of them run at the same time, so every one needs its own thread.
+// Returns false if they didn't meet within a second, meaning a parked worker wasn't woken
+bool RunTogether(nstd::TaskGroup& group, size_t uCount) {
+	std::atomic<size_t> uArrived = 0;
+	std::atomic<bool>	bMet	 = true;
+
+	for (size_t i = 0; i < uCount; ++i) {
+		group.run([&]() {
+			auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+
+			uArrived.fetch_add(1);
+
+			while (uArrived.load() < uCount) {
+				if (std::chrono::steady_clock::now() > deadline) {
+					bMet = false;
+					break;
+				}
+
+				std::this_thread::yield();
+			}
+		});
+	}
+
+	group.wait();
+
+	return bMet;
+}
+
+// Workers park between the rounds, tasks scheduled from outside the pool and from a worker's own deque have to wake them
+void WakesParkedWorkers() {
+	nstd::ThreadPool pool(4);
+
+	for (int iRound = 0; iRound < 20; ++iRound) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+		nstd::TaskGroup outer(pool);
+
+		// The caller helps with one of them
+		assert(RunTogether(outer, 4));
+
+		std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+		std::atomic<bool> bMet = false;
+
+		outer.run([&]() {
+			nstd::TaskGroup inner(pool);
+
+			bMet = RunTogether(inner, 4);
+		});
+
+		outer.wait();
+		assert(bMet);
+	}
+}
+
+int main() {
+	ScansKeepOperandOrder();
+	WakesParkedWorkers();
+
+	std::cout << "Parallel tests passed" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+// Build and run: g++ -std=c++20 SpanTests.cpp -o SpanTests && ./SpanTests
+#include <cassert>
+#include <iostream>
+
+#include "../src/Containers/Span.hpp"
+
+void LiteralZeroCount() {
+	int values[4] = { 1, 2, 3, 4 };
+
+	nstd::Span<int> empty(values, 0);
+	assert(empty.size() == 0 && empty.data() == values);
+
+	nstd::Span<const int> constEmpty(values, 0);
+	assert(constEmpty.size() == 0);
+}
+
+void PointerRange() {
+	int values[4] = { 1, 2, 3, 4 };
+
+	nstd::Span<int> span(values, values + 4);
+	assert(span.size() == 4 && span[3] == 4);
+
+	// Mutable pointers may bound a const view
+	nstd::Span<const int> constSpan(values + 1, values + 3);
+	assert(constSpan.size() == 2 && constSpan[0] == 2);
+
+	nstd::Span<int, 2> fixed(values, values + 2);
+	assert(fixed.size() == 2);
+}
+
+int main() {
+	LiteralZeroCount();
+	PointerRange();
+
+	std::cout << "Span tests passed" << std::endl;
+
+	return 0;
+}
\ No newline at end of file
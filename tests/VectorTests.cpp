@@ -0,0 +1,80 @@
+// Build and run: g++ -std=c++20 VectorTests.cpp -o VectorTests && ./VectorTests
+#include <cstdio>
+#include <string>
+#include <cassert>
+#include <iostream>
+
+#include "../src/Containers/Vector.hpp"
+#include "../src/Containers/FlatMap.hpp"
+#include "../src/IO/Serialization.hpp"
+
+// Counts the instances alive, to catch elements that are never destroyed
+struct Tracked {
+	static inline int s_iAlive = 0;
+
+	Tracked() { ++s_iAlive; }
+	Tracked(const Tracked&) { ++s_iAlive; }
+	Tracked(Tracked&&) noexcept { ++s_iAlive; }
+	Tracked& operator =(const Tracked&) = default;
+	Tracked& operator =(Tracked&&) = default;
+	~Tracked() { --s_iAlive; }
+};
+
+void DestructorDestroysElements() {
+	{
+		nstd::Vector<Tracked> vec(10);
+
+		vec.push_back(Tracked());
+		vec.emplace_back();
+		assert(Tracked::s_iAlive == 12);
+	}
+
+	assert(Tracked::s_iAlive == 0);
+
+	{
+		nstd::Vector<std::string> vec{ std::string(100, 'a'), std::string(100, 'b') };
+		nstd::FlatMap<std::string, std::string> map;
+
+		map.insert({ std::string(100, 'k'), std::string(100, 'v') });
+	}
+}
+
+void SaveAndLoad() {
+	nstd::Vector<int> saved;
+
+	for (int i = 0; i < 100000; ++i)
+		saved.push_back(i * 3);
+
+	assert(nstd::save(saved, "VectorTests.bin"));
+
+	nstd::Vector<int> loaded{ 7 };
+
+	assert(nstd::load(loaded, "VectorTests.bin"));
+	assert(loaded.size() == saved.size() && loaded[0] == 0 && loaded[99999] == 299997);
+
+	// A flipped payload byte fails the checksum and leaves the vector alone
+	std::FILE* pFile = std::fopen("VectorTests.bin", "r+b");
+
+	std::fseek(pFile, 64 + 4000, SEEK_SET);
+	std::fputc(0x55, pFile);
+	std::fclose(pFile);
+
+	nstd::Vector<int> untouched{ 7 };
+
+	assert(!nstd::load(untouched, "VectorTests.bin") && untouched.size() == 1 && untouched[0] == 7);
+
+	nstd::Vector<int> empty;
+
+	assert(nstd::save(empty, "VectorTests.bin") && nstd::load(loaded, "VectorTests.bin") && loaded.empty());
+
+	std::remove("VectorTests.bin");
+}
+
+int main() {
+	DestructorDestroysElements();
+	SaveAndLoad();
+
+	std::cout << "Vector tests passed" << std::endl;
+
+	return 0;
+}
\ No newline at end of file